@@ -0,0 +1,307 @@
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "../MonitoringServer/NetLibrary/Logger/LogArchive.h"
+#include "../MonitoringServer/NetLibrary/Logger/LogFormatter.h"
+
+#define LOG_MESSAGE_MAX_LENGTH 512
+
+////////////////////////////////////////////////
+// ̳ʸ α (.blog) ؽƮ α Ϸ ٲ۴
+//  : LogDecoder.exe <Log_YYYYMMDD_hhmmss.blog> [  (⺻ : Է ϸ + .txt)]
+// ƮǸ  (.xpress)̶  .xpress  ̸ Ǯ, Ǯ  .blog ̾ ȯѴ
+//  ΰ ؽƮ α ϰ  UTF-16 LE (BOM)̴
+// LogDecoder.exe -selftest :  .blog (   ʴ ) <broken> óϴ ˻ (ϸ  ڵ 1)
+////////////////////////////////////////////////
+
+namespace
+{
+	// SITE ڵ ˰  LOGF ȣ ġ
+	struct DecodedSite
+	{
+		std::wstring				Format;
+		std::vector<ELogArgKind>	ArgKinds;
+		bool						bDefined = false;
+	};
+
+	bool hasExtension(const std::wstring& fileName, const WCHAR* extension)
+	{
+		const size_t length = wcslen(extension);
+
+		return fileName.size() >= length && fileName.compare(fileName.size() - length, length, extension) == 0;
+	}
+
+	bool readFile(const WCHAR* fileName, std::vector<char>* outData)
+	{
+		FILE* file;
+
+		if (_wfopen_s(&file, fileName, L"rb") != 0 || file == nullptr)
+		{
+			return false;
+		}
+
+		fseek(file, 0, SEEK_END);
+		const long fileSize = ftell(file);
+		rewind(file);
+
+		outData->resize(fileSize);
+		const size_t readSize = fread(outData->data(), 1, outData->size(), file);
+
+		fclose(file);
+
+		return readSize == outData->size();
+	}
+
+	bool readSite(const char* record, uint16_t recordSize, std::vector<DecodedSite>& sites)
+	{
+		BinaryLogFile::SiteRecord site;
+
+		if (recordSize < sizeof(site))
+		{
+			return false;
+		}
+
+		memcpy(&site, record, sizeof(site));
+
+		const size_t expectedSize = sizeof(site) + site.ArgCount * sizeof(ELogArgKind) + (site.FormatLength + site.FileNameLength) * sizeof(WCHAR);
+
+		if (recordSize != expectedSize)
+		{
+			return false;
+		}
+
+		if (site.SiteID >= sites.size())
+		{
+			sites.resize(site.SiteID + 1);
+		}
+
+		const char* kinds = record + sizeof(site);
+		const char* format = kinds + site.ArgCount * sizeof(ELogArgKind);
+
+		DecodedSite& decodedSite = sites[site.SiteID];
+		decodedSite.ArgKinds.assign(reinterpret_cast<const ELogArgKind*>(kinds), reinterpret_cast<const ELogArgKind*>(kinds) + site.ArgCount);
+		decodedSite.Format.resize(site.FormatLength);
+		memcpy(&decodedSite.Format[0], format, site.FormatLength * sizeof(WCHAR));
+		decodedSite.bDefined = true;
+
+		return true;
+	}
+
+	//  ڿ   .blog Ƿ     ִ (ų ۵ )
+	//  ʴ ڸ swprintf ѱ ߸ ͸ аų CRT invalid parameter Ƿ <broken> ; Ѵ
+	struct FormatCase
+	{
+		const WCHAR*	Format;
+		ELogArgKind		Kind;
+		const char*		Args;
+		uint32_t		ArgsSize;
+		const WCHAR*	Expected;
+	};
+
+	bool runSelfTest(void)
+	{
+		char intArgs[LogFormatter::MAX_ARGS_SIZE];
+		char stringArgs[LogFormatter::MAX_ARGS_SIZE];
+		char doubleArgs[LogFormatter::MAX_ARGS_SIZE];
+
+		const uint32_t intArgsSize = LogFormatter::EncodeArg(intArgs, 0, 42);
+		const uint32_t stringArgsSize = LogFormatter::EncodeArg(stringArgs, 0, L"abc");
+		const uint32_t doubleArgsSize = LogFormatter::EncodeArg(doubleArgs, 0, 1.5);
+
+		const FormatCase cases[] =
+		{
+			// ´ 
+			{ L"value = %d", ELogArgKind::Int32, intArgs, intArgsSize, L"value = 42" },
+			{ L"value = %s", ELogArgKind::String, stringArgs, stringArgsSize, L"value = abc" },
+			{ L"value = %.2f", ELogArgKind::Double, doubleArgs, doubleArgsSize, L"value = 1.50" },
+
+			//    ʴ 
+			{ L"value = %s", ELogArgKind::Int32, intArgs, intArgsSize, L"value = <broken>" },
+			{ L"value = %d", ELogArgKind::String, stringArgs, stringArgsSize, L"value = <broken>" },
+			{ L"value = %lld", ELogArgKind::Int32, intArgs, intArgsSize, L"value = <broken>" },
+			{ L"value = %p", ELogArgKind::Double, doubleArgs, doubleArgsSize, L"value = <broken>" },
+			{ L"value = %n", ELogArgKind::Int32, intArgs, intArgsSize, L"value = <broken>" },
+			{ L"value = %*d", ELogArgKind::Int32, intArgs, intArgsSize, L"value = <broken>" },
+
+			// ڰ ڶ
+			{ L"value = %d", ELogArgKind::Int32, intArgs, 2, L"value = <broken>" },
+		};
+
+		uint32_t failedCount = 0;
+
+		for (const FormatCase& formatCase : cases)
+		{
+			WCHAR expected[LOG_MESSAGE_MAX_LENGTH];
+			swprintf(expected, LOG_MESSAGE_MAX_LENGTH, L"[selftest] : %s\n", formatCase.Expected);
+
+			WCHAR log[LOG_MESSAGE_MAX_LENGTH];
+			LogFormatter::FormatLine(log, LOG_MESSAGE_MAX_LENGTH, L"selftest", formatCase.Format, &formatCase.Kind, 1, formatCase.Args, formatCase.ArgsSize);
+
+			if (wcscmp(log, expected) != 0)
+			{
+				wprintf(L"[FAIL] format = \"%s\" -> %s", formatCase.Format, log);
+				failedCount++;
+			}
+		}
+
+		wprintf(L"selftest : %zu cases, %u failed\n", sizeof(cases) / sizeof(cases[0]), failedCount);
+
+		return failedCount == 0;
+	}
+
+	// LOG ڵ带 ؽƮ  ٷ 
+	uint32_t formatLog(const char* record, uint16_t recordSize, const std::vector<DecodedSite>& sites, WCHAR* outLog)
+	{
+		BinaryLogFile::LogRecord log;
+
+		if (recordSize < sizeof(log))
+		{
+			return 0;
+		}
+
+		memcpy(&log, record, sizeof(log));
+
+		if (log.SiteID >= sites.size() || false == sites[log.SiteID].bDefined)
+		{
+			return static_cast<uint32_t>(swprintf(outLog, LOG_MESSAGE_MAX_LENGTH, L"[!] unknown log site (SiteID = %u)\n", log.SiteID));
+		}
+
+		const DecodedSite& site = sites[log.SiteID];
+
+		WCHAR timeInfo[LogFormatter::TIME_INFO_LENGTH];
+		LogFormatter::GetTimeInfo(log.Time, timeInfo);
+
+		return LogFormatter::FormatLine(outLog, LOG_MESSAGE_MAX_LENGTH, timeInfo, site.Format.c_str(), site.ArgKinds.data(), static_cast<uint32_t>(site.ArgKinds.size()),
+			record + sizeof(log), recordSize - sizeof(log));
+	}
+}
+
+int wmain(int argc, WCHAR* argv[])
+{
+	if (argc < 2)
+	{
+		wprintf(L"usage: LogDecoder.exe <binary log file (.blog) or archived log file (.xpress)> [output file]\n");
+		wprintf(L"       LogDecoder.exe -selftest\n");
+		return 1;
+	}
+
+	if (wcscmp(argv[1], L"-selftest") == 0)
+	{
+		return runSelfTest() ? 0 : 1;
+	}
+
+	std::wstring inputFileName = argv[1];
+
+	if (hasExtension(inputFileName, LogArchive::EXTENSION))
+	{
+		const std::wstring rawFileName = inputFileName.substr(0, inputFileName.size() - wcslen(LogArchive::EXTENSION));
+
+		if (false == LogArchive::DecompressFile(inputFileName.c_str(), rawFileName.c_str()))
+		{
+			wprintf(L"[!] can not decompress %s\n", inputFileName.c_str());
+			return 1;
+		}
+
+		wprintf(L"%s -> %s\n", inputFileName.c_str(), rawFileName.c_str());
+
+		// ؽƮ α ̾ٸ Ǫ  
+		if (false == hasExtension(rawFileName, L".blog"))
+		{
+			return 0;
+		}
+
+		inputFileName = rawFileName;
+	}
+
+	const std::wstring outputFileName = (argc >= 3) ? argv[2] : inputFileName + L".txt";
+
+	std::vector<char> data;
+
+	if (false == readFile(inputFileName.c_str(), &data))
+	{
+		wprintf(L"[!] can not read %s\n", inputFileName.c_str());
+		return 1;
+	}
+
+	BinaryLogFile::FileHeader fileHeader;
+
+	if (data.size() < sizeof(fileHeader))
+	{
+		wprintf(L"[!] %s is not a binary log file\n", inputFileName.c_str());
+		return 1;
+	}
+
+	memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+
+	if (fileHeader.Magic != BinaryLogFile::MAGIC || fileHeader.Version != BinaryLogFile::VERSION)
+	{
+		wprintf(L"[!] %s is not a binary log file (or unsupported version)\n", inputFileName.c_str());
+		return 1;
+	}
+
+	FILE* outputFile;
+
+	if (_wfopen_s(&outputFile, outputFileName.c_str(), L"wb") != 0 || outputFile == nullptr)
+	{
+		wprintf(L"[!] can not create %s\n", outputFileName.c_str());
+		return 1;
+	}
+
+	constexpr unsigned short BOM_UTF_16_LE = 0xFEFF;
+	fwrite(&BOM_UTF_16_LE, sizeof(BOM_UTF_16_LE), 1, outputFile);
+
+	std::vector<DecodedSite> sites;
+	uint64_t logCount = 0;
+	size_t offset = sizeof(fileHeader);
+
+	while (offset + sizeof(BinaryLogFile::RecordHeader) <= data.size())
+	{
+		BinaryLogFile::RecordHeader header;
+		memcpy(&header, data.data() + offset, sizeof(header));
+
+		// ũ   ڵ尡 ߷ȴٸ ű ȯ
+		if (header.Size < sizeof(header) || offset + header.Size > data.size())
+		{
+			wprintf(L"[!] broken record at offset %zu, stop decoding\n", offset);
+			break;
+		}
+
+		const char* record = data.data() + offset;
+		WCHAR log[LOG_MESSAGE_MAX_LENGTH];
+		uint32_t length = 0;
+
+		switch (header.Type)
+		{
+		case BinaryLogFile::RECORD_SITE:
+			if (false == readSite(record, header.Size, sites))
+			{
+				wprintf(L"[!] broken site record at offset %zu\n", offset);
+			}
+			break;
+		case BinaryLogFile::RECORD_LOG:
+			length = formatLog(record, header.Size, sites, log);
+			break;
+		case BinaryLogFile::RECORD_TEXT:
+			fwrite(record + sizeof(header), 1, header.Size - sizeof(header), outputFile);
+			logCount++;
+			break;
+		default:
+			break;
+		}
+
+		if (length > 0)
+		{
+			fwrite(log, sizeof(WCHAR), length, outputFile);
+			logCount++;
+		}
+
+		offset += header.Size;
+	}
+
+	fclose(outputFile);
+
+	wprintf(L"%llu logs -> %s\n", logCount, outputFileName.c_str());
+
+	return 0;
+}
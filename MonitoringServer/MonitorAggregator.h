@@ -0,0 +1,166 @@
+#pragma once
+
+#include <climits>
+#include <cstdint>
+#include <Windows.h>
+
+#include "MonitorProtocol.h"
+
+////////////////////////////////////////////////
+// ( ȣ,  Ÿ) ͸   ̺
+// Add()  忡   ȣ  (հ/ Interlocked , ּ/ִ CAS)
+// Drain()  忡 ȣؾ ϸ,  ٲ    ̺ о 
+////////////////////////////////////////////////
+class MonitorAggregator
+{
+public:
+    enum
+    {
+        MAX_SERVER_NO = 256,    //  ȣ BYTE ۵ǹǷ 0 ~ 255
+        MAX_DATA_TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::MAX
+    };
+
+    MonitorAggregator(void)
+    {
+        for (int epoch = 0; epoch < 2; ++epoch)
+        {
+            mCells[epoch] = new Cell[MAX_SERVER_NO * MAX_DATA_TYPE];
+
+            for (int i = 0; i < MAX_SERVER_NO * MAX_DATA_TYPE; ++i)
+            {
+                resetCell(mCells[epoch][i]);
+            }
+        }
+    }
+
+    ~MonitorAggregator(void)
+    {
+        delete[] mCells[0];
+        delete[] mCells[1];
+    }
+
+    MonitorAggregator(const MonitorAggregator& other) = delete;
+    MonitorAggregator& operator=(const MonitorAggregator& other) = delete;
+
+    //  ϳ 迡 ݿѴ (  serverNo, dataType̶ false)
+    bool Add(const uint32_t serverNo, const uint32_t dataType, const int32_t value)
+    {
+        if (serverNo >= MAX_SERVER_NO || dataType >= MAX_DATA_TYPE)
+        {
+            return false;
+        }
+
+        //     ˸
+        // īƮ ø ̿ Drain()  ٲٸ   ٽ õ
+        LONG epoch;
+        for (;;)
+        {
+            epoch = mEpoch;
+            InterlockedIncrement(&mWriterCounts[epoch].Count);
+
+            if (epoch == mEpoch)
+            {
+                break;
+            }
+
+            InterlockedDecrement(&mWriterCounts[epoch].Count);
+        }
+
+        Cell& cell = mCells[epoch][serverNo * MAX_DATA_TYPE + dataType];
+
+        InterlockedAdd64(&cell.ValueSum, value);
+        InterlockedIncrement(&cell.Count);
+
+        LONG min = cell.Min;
+        while (value < min)
+        {
+            LONG prevMin = InterlockedCompareExchange(&cell.Min, value, min);
+            if (prevMin == min)
+            {
+                break;
+            }
+
+            min = prevMin;
+        }
+
+        LONG max = cell.Max;
+        while (value > max)
+        {
+            LONG prevMax = InterlockedCompareExchange(&cell.Max, value, max);
+            if (prevMax == max)
+            {
+                break;
+            }
+
+            max = prevMax;
+        }
+
+        InterlockedDecrement(&mWriterCounts[epoch].Count);
+
+        return true;
+    }
+
+    // ݱ    ̺ 
+    //   ̶  ĭ func(serverNo, dataType, average, max, min) ȣ
+    template <typename Func>
+    void Drain(Func&& func)
+    {
+        LONG oldEpoch = mEpoch;
+        InterlockedExchange(&mEpoch, oldEpoch ^ 1);
+
+        //    ִ      (Add() ſ ªǷ  )
+        while (mWriterCounts[oldEpoch].Count != 0)
+        {
+            YieldProcessor();
+        }
+
+        Cell* cells = mCells[oldEpoch];
+
+        for (uint32_t serverNo = 0; serverNo < MAX_SERVER_NO; ++serverNo)
+        {
+            for (uint32_t dataType = 1; dataType < MAX_DATA_TYPE; ++dataType)
+            {
+                Cell& cell = cells[serverNo * MAX_DATA_TYPE + dataType];
+
+                if (cell.Count == 0)
+                {
+                    continue;
+                }
+
+                func(serverNo, dataType, static_cast<int32_t>(cell.ValueSum / cell.Count), static_cast<int32_t>(cell.Max), static_cast<int32_t>(cell.Min));
+
+                resetCell(cell);
+            }
+        }
+    }
+
+private:
+
+    //  ĭ ϳ ĳö ϵ  ٸ (, Ÿ)  false sharing ´
+    struct alignas(64) Cell
+    {
+        volatile LONG64 ValueSum;
+        volatile LONG   Count;
+        volatile LONG   Min;
+        volatile LONG   Max;
+    };
+
+    struct alignas(64) WriterCount
+    {
+        volatile LONG   Count;
+    };
+
+    static inline void resetCell(Cell& cell)
+    {
+        cell.ValueSum = 0;
+        cell.Count = 0;
+        cell.Min = INT_MAX;
+        cell.Max = INT_MIN;
+    }
+
+private:
+
+    Cell*                   mCells[2];          //  [serverNo * MAX_DATA_TYPE + dataType] ̺
+    alignas(64) volatile LONG mEpoch = 0;       // Add()  ̺ ȣ
+    WriterCount             mWriterCounts[2]{}; //     
+};
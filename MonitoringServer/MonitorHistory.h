@@ -0,0 +1,203 @@
+#pragma once
+
+#include <cstdint>
+#include <Windows.h>
+
+#include "MonitorPacket.h"
+#include "MonitorProtocol.h"
+
+////////////////////////////////////////////////
+// ( ȣ,  Ÿ) ֱ ͸   ( ޸  )
+//  ø historySeconds ĭ ,  timeStamp % historySeconds ĭ ϵȴ
+//  ĭ [timeStamp 32bit][value 32bit]  64bit ̶     ŵ
+// ø ó    ҴǸ, ޸  Ѿ  ø  ʴ´
+////////////////////////////////////////////////
+class MonitorHistory
+{
+public:
+    enum
+    {
+        MAX_SERVER_NO = 256,
+        MAX_DATA_TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::MAX
+    };
+
+    static_assert(MAX_DATA_TYPE <= 64, "data type must fit in a uint64_t mask");
+
+    MonitorHistory(void) = default;
+
+    ~MonitorHistory(void)
+    {
+        for (int i = 0; i < MAX_SERVER_NO * MAX_DATA_TYPE; ++i)
+        {
+            delete[] mSeries[i];
+        }
+    }
+
+    MonitorHistory(const MonitorHistory& other) = delete;
+    MonitorHistory& operator=(const MonitorHistory& other) = delete;
+
+    // ø    ü ޸   (historySeconds 0̸  )
+    void Init(const uint32_t historySeconds, const uint64_t memoryBudgetBytes)
+    {
+        mHistorySeconds = historySeconds;
+        mMemoryBudgetBytes = memoryBudgetBytes;
+    }
+
+    inline uint32_t GetHistorySeconds(void) const { return mHistorySeconds; }
+    inline uint64_t GetAllocatedBytes(void) const { return mAllocatedBytes; }
+    inline uint32_t GetRejectedCount(void) const { return mRejectedCount; }
+
+    //  ϳ Ѵ ( 忡 ÿ ȣ )
+    void Record(const uint32_t serverNo, const uint32_t dataType, const int32_t value, const int32_t timeStamp)
+    {
+        if (mHistorySeconds == 0 || serverNo >= MAX_SERVER_NO || dataType >= MAX_DATA_TYPE)
+        {
+            return;
+        }
+
+        volatile uint64_t* series = getOrCreateSeries(serverNo * MAX_DATA_TYPE + dataType);
+        if (series == nullptr)
+        {
+            return;
+        }
+
+        const uint32_t slotTimeStamp = static_cast<uint32_t>(timeStamp);
+
+        series[slotTimeStamp % mHistorySeconds] = (static_cast<uint64_t>(slotTimeStamp) << 32) | static_cast<uint32_t>(value);
+    }
+
+    // serverNo  ø   ŸԵ (1 << dataType)
+    uint64_t GetRecordedDataTypeMask(const uint32_t serverNo) const
+    {
+        uint64_t dataTypeMask = 0;
+
+        if (serverNo >= MAX_SERVER_NO)
+        {
+            return 0;
+        }
+
+        for (uint32_t dataType = 1; dataType < MAX_DATA_TYPE; ++dataType)
+        {
+            if (mSeries[serverNo * MAX_DATA_TYPE + dataType] != nullptr)
+            {
+                dataTypeMask |= 1ull << dataType;
+            }
+        }
+
+        return dataTypeMask;
+    }
+
+    // serverNo timeStamp ϵ   dataTypeMask  ͵ outEntries ä  ȯ (outEntries MAX_DATA_TYPEĭ ̻)
+    // ų      ĭ ǳʶڴ
+    uint32_t ReadRow(const uint32_t serverNo, const uint64_t dataTypeMask, const int32_t timeStamp, MonitorPacket::DATA_UPDATE_ENTRY outEntries[]) const
+    {
+        uint32_t entryCount = 0;
+
+        if (mHistorySeconds == 0 || serverNo >= MAX_SERVER_NO)
+        {
+            return 0;
+        }
+
+        const uint32_t slotTimeStamp = static_cast<uint32_t>(timeStamp);
+
+        for (uint32_t dataType = 1; dataType < MAX_DATA_TYPE; ++dataType)
+        {
+            if (0 == (dataTypeMask & (1ull << dataType)))
+            {
+                continue;
+            }
+
+            volatile uint64_t* series = mSeries[serverNo * MAX_DATA_TYPE + dataType];
+            if (series == nullptr)
+            {
+                continue;
+            }
+
+            const uint64_t slot = series[slotTimeStamp % mHistorySeconds];
+
+            if (static_cast<uint32_t>(slot >> 32) != slotTimeStamp)
+            {
+                continue;
+            }
+
+            outEntries[entryCount].DataType = static_cast<uint8_t>(dataType);
+            outEntries[entryCount].DataValue = static_cast<int32_t>(slot & 0xFFFF'FFFF);
+            entryCount++;
+        }
+
+        return entryCount;
+    }
+
+private:
+
+    volatile uint64_t* getOrCreateSeries(const uint32_t seriesIndex)
+    {
+        volatile uint64_t* series = mSeries[seriesIndex];
+        if (series != nullptr)
+        {
+            return series;
+        }
+
+        // ø  ʰ ũ⵵  Ƿ     ķδ  ø   
+        //  Ű    īͿ  ʵ ÷׿ Ϲ б  Ÿ
+        if (mbBudgetExhausted)
+        {
+            rejectSeries(seriesIndex);
+            return nullptr;
+        }
+
+        const LONG64 seriesBytes = static_cast<LONG64>(mHistorySeconds) * sizeof(uint64_t);
+
+        if (static_cast<uint64_t>(mAllocatedBytes + seriesBytes) > mMemoryBudgetBytes)
+        {
+            mbBudgetExhausted = true;
+            rejectSeries(seriesIndex);
+            return nullptr;
+        }
+
+        // Ϲ б  ٸ 尡    Ƿ   ٽ Ȯ
+        if (static_cast<uint64_t>(InterlockedAdd64(&mAllocatedBytes, seriesBytes)) > mMemoryBudgetBytes)
+        {
+            InterlockedAdd64(&mAllocatedBytes, -seriesBytes);
+            mbBudgetExhausted = true;
+            rejectSeries(seriesIndex);
+            return nullptr;
+        }
+
+        uint64_t* newSeries = new uint64_t[mHistorySeconds]{};
+
+        series = reinterpret_cast<volatile uint64_t*>(InterlockedCompareExchangePointer(reinterpret_cast<PVOID volatile*>(&mSeries[seriesIndex]), newSeries, nullptr));
+
+        if (series != nullptr)
+        {
+            // ٸ 尡  
+            delete[] newSeries;
+            InterlockedAdd64(&mAllocatedBytes, -seriesBytes);
+            return series;
+        }
+
+        return newSeries;
+    }
+
+    //  ʰ   ø    (̹  ø б⸸ )
+    void rejectSeries(const uint32_t seriesIndex)
+    {
+        volatile LONG* rejectedBits = &mRejectedSeriesBits[seriesIndex / 32];
+        const LONG bit = static_cast<LONG>(seriesIndex % 32);
+
+        if ((*rejectedBits & (1 << bit)) == 0 && InterlockedBitTestAndSet(rejectedBits, bit) == 0)
+        {
+            InterlockedIncrement(&mRejectedCount);
+        }
+    }
+
+private:
+
+    volatile uint64_t*  mSeries[MAX_SERVER_NO * MAX_DATA_TYPE]{};   // [serverNo * MAX_DATA_TYPE + dataType]
+    uint32_t            mHistorySeconds = 0;
+    uint64_t            mMemoryBudgetBytes = 0;
+    volatile LONG64     mAllocatedBytes = 0;
+    volatile bool       mbBudgetExhausted = false;  //    ̻ ø    (    )
+    volatile LONG       mRejectedCount = 0;     // ޸  ʰ   ø 
+    volatile LONG       mRejectedSeriesBits[(MAX_SERVER_NO * MAX_DATA_TYPE + 31) / 32]{};
+};
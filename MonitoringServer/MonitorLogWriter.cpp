@@ -0,0 +1,629 @@
+#include "MonitorLogWriter.h"
+
+#include "NetLibrary/Logger/Logger.h"
+
+#include <cstring>
+#include <ctime>
+#include <process.h>
+#include <strsafe.h>
+
+MonitorLogWriter::MonitorLogWriter(DBConnector& dbConnection)
+	: mDBConnection(dbConnection)
+{
+}
+
+MonitorLogWriter::~MonitorLogWriter(void)
+{
+	if (mSpoolFile != INVALID_HANDLE_VALUE)
+	{
+		::CloseHandle(mSpoolFile);
+	}
+}
+
+void MonitorLogWriter::Start(void)
+{
+	openSpool();
+
+	mParams.resize(MAX_ROWS_PER_INSERT * PARAM_COUNT_PER_ROW);
+	mParamRows.resize(MAX_ROWS_PER_INSERT);
+
+	mStopEvent = ::CreateEvent(NULL, TRUE, FALSE, NULL);
+	ASSERT_LIVE(mStopEvent != NULL, L"mStopEvent create failed");
+
+	mPushEvent = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+	ASSERT_LIVE(mPushEvent != NULL, L"mPushEvent create failed");
+
+	//  尡 ڸ  õϵ
+	mFailureBeginTick = ::timeGetTime();
+	mNextRetryTick = mFailureBeginTick;
+
+	mWriterThread = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, writerThread, this, 0, nullptr));
+}
+
+void MonitorLogWriter::Stop(void)
+{
+	::SetEvent(mStopEvent);
+
+	::WaitForSingleObject(mWriterThread, INFINITE);
+	::CloseHandle(mWriterThread);
+	::CloseHandle(mStopEvent);
+	::CloseHandle(mPushEvent);
+}
+
+bool MonitorLogWriter::Push(Batch&& batch)
+{
+	mQueueLock.lock();
+
+	if (mQueue.size() >= mQueueCapacity)
+	{
+		mQueueLock.unlock();
+
+		InterlockedIncrement(&mDroppedBatchCount);
+		return false;
+	}
+
+	mQueue.push_back(std::move(batch));
+	mQueuedBatchCount = static_cast<uint32_t>(mQueue.size());
+
+	mQueueLock.unlock();
+
+	::SetEvent(mPushEvent);
+
+	return true;
+}
+
+unsigned int MonitorLogWriter::writerThread(void* writer)
+{
+	LOGF(ELogLevel::System, L"Log DB Writer Thread Start (ID : %d)", ::GetCurrentThreadId());
+
+	MonitorLogWriter* logWriter = reinterpret_cast<MonitorLogWriter*>(writer);
+
+	HANDLE waitEvents[2];
+	waitEvents[0] = logWriter->mStopEvent;
+	waitEvents[1] = logWriter->mPushEvent;
+
+	bool bStopRequested = false;
+	Batch batch;
+
+	while (false == bStopRequested)
+	{
+		DWORD waitTime = INFINITE;
+
+		if (false == logWriter->mbIsDBAvailable)
+		{
+			const int32_t remainTime = static_cast<int32_t>(logWriter->mNextRetryTick - ::timeGetTime());
+			waitTime = (remainTime > 0) ? static_cast<DWORD>(remainTime) : 0;
+		}
+
+		DWORD retWait = ::WaitForMultipleObjects(2, waitEvents, FALSE, waitTime);
+
+		bStopRequested = (retWait == WAIT_OBJECT_0);
+
+		if (false == logWriter->mbIsDBAvailable)
+		{
+			logWriter->tryReconnect();
+		}
+
+		// Ǯ Ͽ ִ ġ ť ִ ͺ  Ƿ  
+		if (logWriter->mbIsDBAvailable && logWriter->mSpooledBatchCount > 0)
+		{
+			if (false == logWriter->replaySpool())
+			{
+				logWriter->onDBFailure();
+			}
+		}
+
+		while (logWriter->mbIsDBAvailable && logWriter->popBatch(batch))
+		{
+			if (false == logWriter->writeBatch(batch))
+			{
+				logWriter->pushFrontBatch(std::move(batch));
+				logWriter->onDBFailure();
+			}
+		}
+
+		// DB а  ̾ų  ̶ ť ġ Ǯ Ϸ ű
+		if (false == logWriter->mbIsDBAvailable)
+		{
+			const DWORD failureTime = ::timeGetTime() - logWriter->mFailureBeginTick;
+
+			if (bStopRequested || failureTime >= logWriter->mSpoolAfterMs)
+			{
+				while (logWriter->popBatch(batch))
+				{
+					if (false == logWriter->appendSpool(batch))
+					{
+						logWriter->pushFrontBatch(std::move(batch));
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	if (logWriter->mQueuedBatchCount > 0)
+	{
+		LOGF(ELogLevel::Error, L"Log DB Writer lost %u batches on shutdown", logWriter->mQueuedBatchCount);
+	}
+
+	logWriter->closeInsertStatements();
+
+	if (logWriter->mDBConnection.IsConnected())
+	{
+		logWriter->mDBConnection.Disconnect();
+	}
+
+	LOGF(ELogLevel::System, L"Log DB Writer Thread End (ID : %d)", ::GetCurrentThreadId());
+
+	return 0;
+}
+
+void MonitorLogWriter::tryReconnect(void)
+{
+	const DWORD currentTick = ::timeGetTime();
+
+	if (static_cast<int32_t>(mNextRetryTick - currentTick) > 0)
+	{
+		return;
+	}
+
+	if (mDBConnection.Connect())
+	{
+		LOGF(ELogLevel::System, L"DB successfully Connected (offline for %u ms)", currentTick - mFailureBeginTick);
+
+		mbIsDBAvailable = true;
+		mRetryDelayMs = MIN_RETRY_DELAY_MS;
+		return;
+	}
+
+	LOGF(ELogLevel::Error, L"DB Connect Failed (error = %d), retry after %u ms", mDBConnection.GetLastError(), mRetryDelayMs);
+
+	mNextRetryTick = currentTick + mRetryDelayMs;
+	mRetryDelayMs = min(mRetryDelayMs * 2, static_cast<DWORD>(MAX_RETRY_DELAY_MS));
+}
+
+void MonitorLogWriter::onDBFailure(void)
+{
+	LOGF(ELogLevel::Error, L"Log DB Write Failed (error = %d), reconnecting", mDBConnection.GetLastError());
+
+	closeInsertStatements();
+	mDBConnection.Disconnect();
+
+	mbIsDBAvailable = false;
+	mFailureBeginTick = ::timeGetTime();
+	mNextRetryTick = mFailureBeginTick + mRetryDelayMs;
+}
+
+bool MonitorLogWriter::writeBatch(const Batch& batch)
+{
+	const time_t logTime = static_cast<time_t>(batch.LogTime);
+	tm localTime;
+	localtime_s(&localTime, &logTime);
+
+	//  ٲ  ̺ ٲǷ ĳõ  
+	const int month = (localTime.tm_year + 1900) * 100 + (localTime.tm_mon + 1);
+
+	if (month != mInsertStatementsMonth)
+	{
+		closeInsertStatements();
+		mInsertStatementsMonth = month;
+	}
+
+	// ึ (logtime, serverno, type, avr, max, min)
+	int64_t logTimeParam = batch.LogTime;
+
+	const uint32_t totalRowCount = static_cast<uint32_t>(batch.Rows.size());
+
+	// INSERT    ġ Ʈ ´
+	// Ϻθ  ä ϸ ġ ü ٽ ǹǷ ̹   ߺǱ 
+	const bool bTransaction = totalRowCount > MAX_ROWS_PER_INSERT;
+
+	if (bTransaction)
+	{
+		// ̺ (CREATE TABLE) Ϲ ĿԵǹǷ ʿ  Ʈ  ̸ غѴ
+		const uint32_t lastRowCount = totalRowCount % MAX_ROWS_PER_INSERT;
+
+		if (getInsertStatement(localTime, MAX_ROWS_PER_INSERT) == nullptr
+			|| (lastRowCount > 0 && getInsertStatement(localTime, lastRowCount) == nullptr)
+			|| false == mDBConnection.Execute(L"START TRANSACTION"))
+		{
+			return false;
+		}
+	}
+
+	for (uint32_t offset = 0; offset < totalRowCount; offset += MAX_ROWS_PER_INSERT)
+	{
+		const uint32_t rowCount = min(totalRowCount - offset, static_cast<uint32_t>(MAX_ROWS_PER_INSERT));
+
+		MYSQL_STMT* insertStatement = getInsertStatement(localTime, rowCount);
+		if (insertStatement == nullptr)
+		{
+			if (bTransaction)
+			{
+				mDBConnection.Execute(L"ROLLBACK");
+			}
+
+			return false;
+		}
+
+		MYSQL_BIND* params = mParams.data();
+
+		::ZeroMemory(params, sizeof(MYSQL_BIND) * rowCount * PARAM_COUNT_PER_ROW);
+
+		for (uint32_t i = 0; i < rowCount; ++i)
+		{
+			// MYSQL_BIND::buffer const ƴϹǷ ġ  ε ۿ ؼ Ѵ
+			Row& row = mParamRows[i];
+			row = batch.Rows[offset + i];
+
+			MYSQL_BIND* rowParams = &params[i * PARAM_COUNT_PER_ROW];
+
+			rowParams[0].buffer_type = MYSQL_TYPE_LONGLONG;
+			rowParams[0].buffer = &logTimeParam;
+
+			int32_t* const columns[] = { &row.ServerNo, &row.Type, &row.Average, &row.Max, &row.Min };
+
+			static_assert(sizeof(columns) / sizeof(columns[0]) == PARAM_COUNT_PER_ROW - 1, "columns must match PARAM_COUNT_PER_ROW");
+
+			for (uint32_t column = 0; column < PARAM_COUNT_PER_ROW - 1; ++column)
+			{
+				rowParams[column + 1].buffer_type = MYSQL_TYPE_LONG;
+				rowParams[column + 1].buffer = columns[column];
+			}
+		}
+
+		if (false == mDBConnection.ExecutePrepared(insertStatement, params))
+		{
+			if (bTransaction)
+			{
+				mDBConnection.Execute(L"ROLLBACK");
+			}
+
+			return false;
+		}
+	}
+
+	if (bTransaction && false == mDBConnection.Execute(L"COMMIT"))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+MYSQL_STMT* MonitorLogWriter::getInsertStatement(const tm& localTime, const uint32_t rowCount)
+{
+	auto it = mInsertStatements.find(rowCount);
+	if (it != mInsertStatements.end())
+	{
+		return it->second;
+	}
+
+	char tableName[32];
+	StringCchPrintfA(tableName, sizeof(tableName), "logdb.monitorlog_%04d%02d", localTime.tm_year + 1900, localTime.tm_mon + 1);
+
+	std::string query = "INSERT INTO ";
+	query += tableName;
+	query += " (`logtime`, `serverno`, `type`, `avr`, `max`, `min`) VALUES ";
+
+	for (uint32_t i = 0; i < rowCount; ++i)
+	{
+		query += (i == 0) ? "(FROM_UNIXTIME(?),?,?,?,?,?)" : ",(FROM_UNIXTIME(?),?,?,?,?,?)";
+	}
+
+	MYSQL_STMT* insertStatement = mDBConnection.Prepare(query.c_str());
+
+	// ̹  ̺  
+	if (insertStatement == nullptr && mDBConnection.GetLastError() == 1146)
+	{
+		if (false == mDBConnection.Execute(L"CREATE TABLE logdb.monitorlog_%04d%02d LIKE logdb.monitorlog", localTime.tm_year + 1900, localTime.tm_mon + 1))
+		{
+			return nullptr;
+		}
+
+		insertStatement = mDBConnection.Prepare(query.c_str());
+	}
+
+	if (insertStatement != nullptr)
+	{
+		mInsertStatements.insert(std::make_pair(rowCount, insertStatement));
+	}
+
+	return insertStatement;
+}
+
+void MonitorLogWriter::closeInsertStatements(void)
+{
+	for (auto& statement : mInsertStatements)
+	{
+		mDBConnection.ClosePrepared(statement.second);
+	}
+
+	mInsertStatements.clear();
+}
+
+bool MonitorLogWriter::popBatch(Batch& outBatch)
+{
+	std::lock_guard<std::mutex> guard(mQueueLock);
+
+	if (mQueue.empty())
+	{
+		return false;
+	}
+
+	outBatch = std::move(mQueue.front());
+	mQueue.pop_front();
+	mQueuedBatchCount = static_cast<uint32_t>(mQueue.size());
+
+	return true;
+}
+
+void MonitorLogWriter::pushFrontBatch(Batch&& batch)
+{
+	// 뷮 Ѵ ǵ ( 尡 ´ ڸ)
+	std::lock_guard<std::mutex> guard(mQueueLock);
+
+	mQueue.push_front(std::move(batch));
+	mQueuedBatchCount = static_cast<uint32_t>(mQueue.size());
+}
+
+void MonitorLogWriter::openSpool(void)
+{
+	mSpoolFile = ::CreateFile(mSpoolFileName.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+	ASSERT_LIVE(mSpoolFile != INVALID_HANDLE_VALUE, L"Log DB spool file CreateFile() failed");
+
+	//  ࿡   ڵ  (߰  κ   ǳʶڴ)
+	const int64_t fileSize = getSpoolFileSize();
+
+	Batch batch;
+	int64_t offset = 0;
+	int64_t validEndOffset = 0;
+	int64_t nextOffset;
+	int64_t skippedBytes = 0;
+	ESpoolRead ret;
+
+	while ((ret = readNextSpoolRecord(&offset, fileSize, batch, &nextOffset, &skippedBytes)) == ESpoolRead::Record)
+	{
+		mSpooledBatchCount++;
+		offset = nextOffset;
+		validEndOffset = nextOffset;
+	}
+
+	ASSERT_LIVE(ret == ESpoolRead::End, L"Log DB spool file ReadFile() failed");
+
+	//  ڵ ڴ ٰ  ڵ̹Ƿ ߶󳽴
+	if (validEndOffset < fileSize)
+	{
+		LOGF(ELogLevel::Error, L"Log DB spool file has a torn tail (offset = %lld, %lld bytes), truncated", validEndOffset, fileSize - validEndOffset);
+
+		skippedBytes -= fileSize - validEndOffset;
+		mSpoolLostBytes += fileSize - validEndOffset;
+		truncateSpool(validEndOffset);
+	}
+
+	if (mSpooledBatchCount > 0)
+	{
+		LOGF(ELogLevel::System, L"Log DB spool file has %u batches to replay (%lld broken bytes to skip)", mSpooledBatchCount, skippedBytes);
+	}
+}
+
+bool MonitorLogWriter::appendSpool(const Batch& batch)
+{
+	SpoolRecordHeader header;
+	header.Magic = SPOOL_RECORD_MAGIC;
+	header.RowCount = static_cast<uint32_t>(batch.Rows.size());
+	header.LogTime = batch.LogTime;
+
+	LARGE_INTEGER distance{};
+	LARGE_INTEGER endOffset{};
+	::SetFilePointerEx(mSpoolFile, distance, &endOffset, FILE_END);
+
+	const DWORD rowsSize = static_cast<DWORD>(sizeof(Row) * batch.Rows.size());
+	DWORD writtenHeader = 0;
+	DWORD writtenRows = 0;
+
+	if (FALSE == ::WriteFile(mSpoolFile, &header, sizeof(header), &writtenHeader, nullptr)
+		|| FALSE == ::WriteFile(mSpoolFile, batch.Rows.data(), rowsSize, &writtenRows, nullptr)
+		|| FALSE == ::FlushFileBuffers(mSpoolFile))
+	{
+		//   ڵ带 ܵθ  ڵ  ڿ پ    ǹǷ ̱  ǵ
+		LOGF(ELogLevel::Error, L"Log DB spool file write failed (error = %u), rolled back to %lld", ::GetLastError(), endOffset.QuadPart);
+		truncateSpool(endOffset.QuadPart);
+		return false;
+	}
+
+	mSpooledBatchCount++;
+
+	return true;
+}
+
+bool MonitorLogWriter::replaySpool(void)
+{
+	LOGF(ELogLevel::System, L"Log DB spool replay begin (%u batches)", mSpooledBatchCount);
+
+	// Ǯ Ͽ ̴ ͵  ̹Ƿ ϴ  ũⰡ ٲ ʴ´
+	const int64_t fileSize = getSpoolFileSize();
+
+	Batch batch;
+	int64_t recordOffset;
+	int64_t nextOffset;
+
+	for (;;)
+	{
+		recordOffset = mSpoolReadOffset;
+
+		int64_t skippedBytes = 0;
+		const ESpoolRead ret = readNextSpoolRecord(&recordOffset, fileSize, batch, &nextOffset, &skippedBytes);
+
+		if (skippedBytes > 0)
+		{
+			LOGF(ELogLevel::Error, L"Log DB spool file has a broken record (offset = %lld), skipped %lld bytes", mSpoolReadOffset, skippedBytes);
+			mSpoolLostBytes += skippedBytes;
+		}
+
+		mSpoolReadOffset = recordOffset;
+
+		if (ret == ESpoolRead::Error)
+		{
+			//    ̹Ƿ DB  ϰ  ̾ Ѵ
+			LOGF(ELogLevel::Error, L"Log DB spool file read failed (offset = %lld, error = %u)", mSpoolReadOffset, ::GetLastError());
+			return true;
+		}
+
+		if (ret == ESpoolRead::End)
+		{
+			break;
+		}
+
+		if (false == writeBatch(batch))
+		{
+			return false;
+		}
+
+		mSpoolReadOffset = nextOffset;
+
+		if (mSpooledBatchCount > 0)
+		{
+			mSpooledBatchCount--;
+		}
+	}
+
+	//     
+	if (mSpoolReadOffset == fileSize)
+	{
+		truncateSpool(0);
+		mSpoolReadOffset = 0;
+		mSpooledBatchCount = 0;
+	}
+
+	LOGF(ELogLevel::System, L"Log DB spool replay end");
+
+	return true;
+}
+
+MonitorLogWriter::ESpoolRead MonitorLogWriter::readSpoolRecord(const int64_t offset, const int64_t fileSize, Batch& outBatch, int64_t* outNextOffset)
+{
+	if (offset >= fileSize)
+	{
+		return ESpoolRead::End;
+	}
+
+	LARGE_INTEGER distance;
+	distance.QuadPart = offset;
+	::SetFilePointerEx(mSpoolFile, distance, nullptr, FILE_BEGIN);
+
+	SpoolRecordHeader header;
+	DWORD readBytes = 0;
+
+	if (FALSE == ::ReadFile(mSpoolFile, &header, sizeof(header), &readBytes, nullptr))
+	{
+		return ESpoolRead::Error;
+	}
+
+	if (readBytes != sizeof(header) || header.Magic != SPOOL_RECORD_MAGIC || header.RowCount > MAX_ROWS_PER_BATCH)
+	{
+		return ESpoolRead::Broken;
+	}
+
+	const DWORD rowsSize = static_cast<DWORD>(sizeof(Row) * header.RowCount);
+
+	if (offset + static_cast<int64_t>(sizeof(header) + rowsSize) > fileSize)
+	{
+		return ESpoolRead::Broken;
+	}
+
+	outBatch.LogTime = header.LogTime;
+	outBatch.Rows.resize(header.RowCount);
+
+	if (FALSE == ::ReadFile(mSpoolFile, outBatch.Rows.data(), rowsSize, &readBytes, nullptr))
+	{
+		return ESpoolRead::Error;
+	}
+
+	if (readBytes != rowsSize)
+	{
+		return ESpoolRead::Broken;
+	}
+
+	*outNextOffset = offset + sizeof(header) + rowsSize;
+
+	return ESpoolRead::Record;
+}
+
+MonitorLogWriter::ESpoolRead MonitorLogWriter::readNextSpoolRecord(int64_t* inOutOffset, const int64_t fileSize, Batch& outBatch, int64_t* outNextOffset, int64_t* outSkippedBytes)
+{
+	int64_t offset = *inOutOffset;
+
+	for (;;)
+	{
+		const ESpoolRead ret = readSpoolRecord(offset, fileSize, outBatch, outNextOffset);
+
+		if (ret == ESpoolRead::Error)
+		{
+			return ret;
+		}
+
+		if (ret != ESpoolRead::Broken)
+		{
+			*outSkippedBytes += offset - *inOutOffset;
+			*inOutOffset = (ret == ESpoolRead::End) ? fileSize : offset;
+
+			return ret;
+		}
+
+		//  ڵ -  ڵ   ִ  ٽ д´
+		offset = findSpoolRecordMagic(offset + 1, fileSize);
+	}
+}
+
+int64_t MonitorLogWriter::findSpoolRecordMagic(const int64_t offset, const int64_t fileSize)
+{
+	char buffer[4096];
+	int64_t bufferOffset = offset;
+
+	while (bufferOffset + static_cast<int64_t>(sizeof(uint32_t)) <= fileSize)
+	{
+		LARGE_INTEGER distance;
+		distance.QuadPart = bufferOffset;
+		::SetFilePointerEx(mSpoolFile, distance, nullptr, FILE_BEGIN);
+
+		DWORD readBytes = 0;
+
+		if (FALSE == ::ReadFile(mSpoolFile, buffer, sizeof(buffer), &readBytes, nullptr) || readBytes < sizeof(uint32_t))
+		{
+			break;
+		}
+
+		for (DWORD i = 0; i + sizeof(uint32_t) <= readBytes; ++i)
+		{
+			uint32_t magic;
+			memcpy(&magic, buffer + i, sizeof(magic));
+
+			if (magic == SPOOL_RECORD_MAGIC)
+			{
+				return bufferOffset + i;
+			}
+		}
+
+		//  迡 ģ MAGIC ã  ֵ  3Ʈ  ٽ д´
+		bufferOffset += readBytes - (sizeof(uint32_t) - 1);
+	}
+
+	return fileSize;
+}
+
+int64_t MonitorLogWriter::getSpoolFileSize(void) const
+{
+	LARGE_INTEGER fileSize{};
+	::GetFileSizeEx(mSpoolFile, &fileSize);
+
+	return fileSize.QuadPart;
+}
+
+void MonitorLogWriter::truncateSpool(const int64_t offset)
+{
+	LARGE_INTEGER distance;
+	distance.QuadPart = offset;
+	::SetFilePointerEx(mSpoolFile, distance, nullptr, FILE_BEGIN);
+	::SetEndOfFile(mSpoolFile);
+}
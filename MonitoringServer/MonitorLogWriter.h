@@ -0,0 +1,190 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Windows.h>
+
+#include "NetLibrary/DBConnector/DBConnector.h"
+
+////////////////////////////////////////////////
+// ͸ α DB 
+// Push()  ġ ũⰡ ѵ ť ̰,  尡  DB Ѵ
+// DB 忡 ϸ     翬 õϸ,
+// а spoolAfterSeconds ̻ ̾ ť ġ  Ǯ Ͽ ٿ ξٰ DB ƿ  Ѵ
+// ġ ϳ   ǰų   ʴ´ (INSERT    Ʈ )
+// (COMMIT   ϰ    ġ     ִ - ּ   )
+// DB   DBConnector  Լ ϹǷ ¥ Ŀͷ и   ִ
+////////////////////////////////////////////////
+class MonitorLogWriter
+{
+public:
+    // (, Ÿ) ϳ  
+    struct Row
+    {
+        int32_t ServerNo;
+        int32_t Type;
+        int32_t Average;
+        int32_t Max;
+        int32_t Min;
+    };
+
+    //     , LogTime(time_t)   ̺ logtime ÷ Ѵ
+    struct Batch
+    {
+        int64_t             LogTime;
+        std::vector<Row>    Rows;
+    };
+
+    enum
+    {
+        DEFAULT_QUEUE_CAPACITY = 64,
+        DEFAULT_SPOOL_AFTER_SECONDS = 30,
+        MIN_RETRY_DELAY_MS = 1'000,
+        MAX_RETRY_DELAY_MS = 60'000,
+        MAX_ROWS_PER_INSERT = 128,      // INSERT  ϳ  ִ  
+        PARAM_COUNT_PER_ROW = 6,        // (logtime, serverno, type, avr, max, min)
+        MAX_ROWS_PER_BATCH = 256 * 64   // Ǯ   ( ȣ  *  Ÿ  ˳)
+    };
+
+    explicit MonitorLogWriter(DBConnector& dbConnection);
+    ~MonitorLogWriter(void);
+
+    MonitorLogWriter(const MonitorLogWriter& other) = delete;
+    MonitorLogWriter& operator=(const MonitorLogWriter& other) = delete;
+
+public: //    Լ
+
+    // ť ׾Ƶ  ִ ִ ġ  (0̸ DEFAULT_QUEUE_CAPACITY)
+    void SetQueueCapacity(const uint32_t batchCount) { mQueueCapacity = (batchCount == 0) ? DEFAULT_QUEUE_CAPACITY : batchCount; }
+
+    // DB а  ð ̻ ̾ ť ġ Ǯ Ϸ ű
+    void SetSpoolAfterSeconds(const uint32_t seconds) { mSpoolAfterMs = seconds * 1'000; }
+
+    // Ǯ   ( ࿡  Ǯ  ִٸ DB   Ѵ)
+    void SetSpoolFileName(const WCHAR* fileName) { mSpoolFileName = fileName; }
+
+public:
+
+    // Ǯ      (DB   尡 õѴ)
+    void Start(void);
+
+    // ť  ġ (DB ٸ Ǯ)ϰ  尡    
+    void Stop(void);
+
+    // ġ ť ִ´, ť  áٸ  false
+    bool Push(Batch&& batch);
+
+public: // 
+
+    bool        IsDBAvailable(void) const { return mbIsDBAvailable; }
+    uint32_t    GetQueuedBatchCount(void) const { return mQueuedBatchCount; }
+    uint32_t    GetSpooledBatchCount(void) const { return mSpooledBatchCount; }
+    uint32_t    GetDroppedBatchCount(void) const { return mDroppedBatchCount; }
+    uint64_t    GetSpoolLostBytes(void) const { return mSpoolLostBytes; }
+
+private:
+
+    static unsigned int writerThread(void* writer);
+
+    // 翬 ð Ǿٸ  õ, ϸ  õ ð   ڷ ̷
+    void tryReconnect(void);
+
+    //   ó -    翬 · ȯ
+    void onDBFailure(void);
+
+    // ġ ϳ DB  (ϸ ƹ ൵   ä false)
+    bool writeBatch(const Batch& batch);
+
+    // rowCount  ִ INSERT  ƮƮ ´ (̺ ٸ , ϸ nullptr)
+    MYSQL_STMT* getInsertStatement(const tm& localTime, const uint32_t rowCount);
+
+    // ĳõ INSERT  ƮƮ  
+    void closeInsertStatements(void);
+
+    // ť   ġ  (ٸ false)
+    bool popBatch(Batch& outBatch);
+
+    // ġ ť   ǵ (忡  ġ)
+    void pushFrontBatch(Batch&& batch);
+
+private: // Ǯ 
+
+    enum class ESpoolRead
+    {
+        Record,     // ڵ带 
+        End,        //  
+        Broken,     // ų  ߸ ڵ
+        Error,      //  б 
+    };
+
+    // Ǯ   ִ ڵ   ( ڵ  ߸ κ ߶󳽴)
+    void openSpool(void);
+
+    // ġ Ǯ   δ, ϸ ̱  ũ ǵ
+    bool appendSpool(const Batch& batch);
+
+    // Ǯ  ڵ DB Ѵ,   ߴٸ   (DB 忡 ϸ false)
+    bool replaySpool(void);
+
+    // offset ġ ڵ带 д´
+    ESpoolRead readSpoolRecord(const int64_t offset, const int64_t fileSize, Batch& outBatch, int64_t* outNextOffset);
+
+    // *inOutOffset   ڵ带 д´ (Record, End, Error  ϳ ȯ)
+    //  κ  SPOOL_RECORD_MAGIC ǳʶٰ  ũ⸦ outSkippedBytes Ѵ, *inOutOffset  ڵ ġ (End  ũ)
+    ESpoolRead readNextSpoolRecord(int64_t* inOutOffset, const int64_t fileSize, Batch& outBatch, int64_t* outNextOffset, int64_t* outSkippedBytes);
+
+    // offset Ŀ SPOOL_RECORD_MAGIC ִ ġ ã´ (ٸ fileSize)
+    int64_t findSpoolRecordMagic(const int64_t offset, const int64_t fileSize);
+
+    int64_t getSpoolFileSize(void) const;
+
+    // offset ĸ ߶󳽴
+    void truncateSpool(const int64_t offset);
+
+    struct SpoolRecordHeader
+    {
+        uint32_t    Magic;
+        uint32_t    RowCount;
+        int64_t     LogTime;
+    };
+
+    static constexpr uint32_t SPOOL_RECORD_MAGIC = 0x474C'4F4D; // "MOLG"
+
+private:
+
+    DBConnector&                                mDBConnection;
+
+    // ť (: Push() ȣϴ , Һ: writerThread)
+    std::deque<Batch>                           mQueue;
+    std::mutex                                  mQueueLock;
+    uint32_t                                    mQueueCapacity = DEFAULT_QUEUE_CAPACITY;
+    volatile uint32_t                           mQueuedBatchCount = 0;
+    volatile uint32_t                           mDroppedBatchCount = 0;
+
+    // Ʒ  writerThread 
+    volatile bool                               mbIsDBAvailable = false;
+    DWORD                                       mFailureBeginTick = 0;  // DB     ð
+    DWORD                                       mNextRetryTick = 0;
+    DWORD                                       mRetryDelayMs = MIN_RETRY_DELAY_MS;
+    uint32_t                                    mSpoolAfterMs = DEFAULT_SPOOL_AFTER_SECONDS * 1'000;
+
+    std::unordered_map<uint32_t, MYSQL_STMT*>   mInsertStatements;      //   -> ش   ִ INSERT 
+    int                                         mInsertStatementsMonth = 0; // mInsertStatements  ϴ ̺ (yyyymm)
+    std::vector<MYSQL_BIND>                     mParams;
+    std::vector<Row>                            mParamRows;             // mParams Ű (serverno, type, avr, max, min) 
+
+    std::wstring                                mSpoolFileName = L"MonitorLogSpool.dat";
+    HANDLE                                      mSpoolFile = INVALID_HANDLE_VALUE;
+    int64_t                                     mSpoolReadOffset = 0;   //    ù ڵ ġ
+    volatile uint32_t                           mSpooledBatchCount = 0; //    ڵ 
+    volatile uint64_t                           mSpoolLostBytes = 0;    //  ڵ  ϰ ǳʶ ũ
+
+    //     ̺Ʈ
+    HANDLE                                      mWriterThread = nullptr;
+    HANDLE                                      mStopEvent = nullptr;
+    HANDLE                                      mPushEvent = nullptr;
+};
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+
+#include "MonitorProtocol.h"
+#include "NetLibrary/NetServer/PacketSchema.h"
+
+////////////////////////////////////////////////
+// ͸  ޼  (ʵ  MonitorProtocol.h)
+//  ޼ ⿡ ü ߰ϰ PacketSchema<޼> а 
+////////////////////////////////////////////////
+namespace MonitorPacket
+{
+#pragma pack(push, 1)
+
+    //------------------------------------------------------
+    // Server -> Monitor
+    //------------------------------------------------------
+    struct SS_MONITOR_LOGIN
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_SS_MONITOR_LOGIN;
+
+        int32_t     ServerNo;
+    };
+
+    struct SS_MONITOR_DATA_UPDATE
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_SS_MONITOR_DATA_UPDATE;
+
+        uint8_t     DataType;
+        int32_t     DataValue;
+        int32_t     TimeStamp;
+    };
+
+    // ġ ޼ Ʈ (SS / CS )
+    struct DATA_UPDATE_ENTRY
+    {
+        uint8_t     DataType;
+        int32_t     DataValue;
+    };
+
+    // ڿ DATA_UPDATE_ENTRY * Count
+    struct SS_MONITOR_DATA_UPDATE_BATCH
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_SS_MONITOR_DATA_UPDATE_BATCH;
+
+        int32_t     TimeStamp;
+        uint8_t     Count;
+    };
+
+    //------------------------------------------------------
+    // Monitor <-> Monitor Tool
+    //------------------------------------------------------
+    struct CS_MONITOR_TOOL_REQ_LOGIN
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_REQ_LOGIN;
+
+        char        LoginSessionKey[32];
+    };
+
+    // Capability  α û (Ÿ CS_MONITOR_TOOL_REQ_LOGIN  ̷ )
+    struct CS_MONITOR_TOOL_REQ_LOGIN_EX
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_REQ_LOGIN;
+
+        char        LoginSessionKey[32];
+        uint8_t     Capability;     // en_PACKET_CS_MONITOR_TOOL_CAPABILITY Ʈ 
+    };
+
+    struct CS_MONITOR_TOOL_RES_LOGIN
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_RES_LOGIN;
+
+        uint8_t     Status;
+    };
+
+    struct CS_MONITOR_TOOL_DATA_UPDATE
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE;
+
+        uint8_t     ServerNo;
+        uint8_t     DataType;
+        int32_t     DataValue;
+        int32_t     TimeStamp;
+    };
+
+    // ڿ DATA_UPDATE_ENTRY * Count
+    struct CS_MONITOR_TOOL_DATA_UPDATE_BATCH
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE_BATCH;
+
+        uint8_t     ServerNo;
+        int32_t     TimeStamp;
+        uint8_t     Count;
+    };
+
+    // ڿ SUBSCRIBE_SERVER_ENTRY * Count (Count 0̸  )
+    struct CS_MONITOR_TOOL_REQ_SUBSCRIBE
+    {
+        static constexpr uint16_t TYPE = en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_REQ_SUBSCRIBE;
+
+        uint64_t    DataTypeMask;
+        uint8_t     Count;
+    };
+
+    struct SUBSCRIBE_SERVER_ENTRY
+    {
+        uint8_t     ServerNo;
+    };
+
+#pragma pack(pop)
+
+    using SS_MONITOR_DATA_UPDATE_BATCH_SCHEMA = PacketArraySchema<SS_MONITOR_DATA_UPDATE_BATCH, DATA_UPDATE_ENTRY>;
+    using CS_MONITOR_TOOL_DATA_UPDATE_BATCH_SCHEMA = PacketArraySchema<CS_MONITOR_TOOL_DATA_UPDATE_BATCH, DATA_UPDATE_ENTRY>;
+    using CS_MONITOR_TOOL_REQ_SUBSCRIBE_SCHEMA = PacketArraySchema<CS_MONITOR_TOOL_REQ_SUBSCRIBE, SUBSCRIBE_SERVER_ENTRY>;
+
+    // ͸  ޴   ޼ (NetServer::SetMaxPayloadLength)
+    static constexpr uint32_t MAX_RECEIVE_PAYLOAD_LENGTH = SS_MONITOR_DATA_UPDATE_BATCH_SCHEMA::MAX_PACKET_SIZE;
+
+    static_assert(CS_MONITOR_TOOL_REQ_SUBSCRIBE_SCHEMA::MAX_PACKET_SIZE <= MAX_RECEIVE_PAYLOAD_LENGTH);
+
+    //  ʵ庰 ϴ ̿  Ȯ
+    static_assert(PacketSchema<SS_MONITOR_LOGIN>::PACKET_SIZE == 2 + 4);
+    static_assert(PacketSchema<SS_MONITOR_DATA_UPDATE>::PACKET_SIZE == 2 + 1 + 4 + 4);
+    static_assert(PacketSchema<CS_MONITOR_TOOL_REQ_LOGIN>::PACKET_SIZE == 2 + 32);
+    static_assert(PacketSchema<CS_MONITOR_TOOL_REQ_LOGIN_EX>::PACKET_SIZE == 2 + 32 + 1);
+    static_assert(PacketSchema<CS_MONITOR_TOOL_RES_LOGIN>::PACKET_SIZE == 2 + 1);
+    static_assert(PacketSchema<CS_MONITOR_TOOL_DATA_UPDATE>::PACKET_SIZE == 2 + 1 + 1 + 4 + 4);
+    static_assert(SS_MONITOR_DATA_UPDATE_BATCH_SCHEMA::GetPacketSize(1) == 2 + 4 + 1 + (1 + 4));
+    static_assert(CS_MONITOR_TOOL_DATA_UPDATE_BATCH_SCHEMA::GetPacketSize(1) == 2 + 1 + 4 + 1 + (1 + 4));
+    static_assert(CS_MONITOR_TOOL_REQ_SUBSCRIBE_SCHEMA::GetPacketSize(1) == 2 + 8 + 1 + 1);
+}
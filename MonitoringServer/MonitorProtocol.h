@@ -54,6 +54,24 @@ enum en_PACKET_TYPE
 	//------------------------------------------------------------
 	en_PACKET_SS_MONITOR_DATA_UPDATE,
 
+	//------------------------------------------------------------
+	//  ͸  ð  ͸   
+	// en_PACKET_SS_MONITOR_DATA_UPDATE  Count   Ͱ .
+	//
+	//	{
+	//		WORD	Type
+	//
+	//		int		TimeStamp				//  Ͱ ϴ TIMESTAMP
+	//		BYTE	Count					//  
+	//		{
+	//			BYTE	DataType
+	//			int		DataValue
+	//		}	* Count
+	//	}
+	//
+	//------------------------------------------------------------
+	en_PACKET_SS_MONITOR_DATA_UPDATE_BATCH,
+
 
 	en_PACKET_CS_MONITOR = 25000,
 	//------------------------------------------------------
@@ -67,6 +85,8 @@ enum en_PACKET_TYPE
 	//
 	//		char	LoginSessionKey[32]		// α  Ű. (̴ ͸   )
 	//										//  ͸   Ű  ; 
+	//		BYTE	Capability				// ( )  ϴ , ϴ Define  Ʈ 
+	//										// ϸ 0 (en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE  )
 	//	}
 	//
 	//------------------------------------------------------------
@@ -108,6 +128,44 @@ enum en_PACKET_TYPE
 	//------------------------------------------------------------
 	en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE,
 
+	//------------------------------------------------------------
+	// ͸  ͸ Ŭ̾Ʈ()     ð ͵  
+	// α  dfMONITOR_TOOL_CAPABILITY_BATCH   Ը ϸ,
+	// ׷   en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE  Count  ޴´.
+	//
+	//	{
+	//		WORD	Type
+	//
+	//		BYTE	ServerNo				//  No
+	//		int		TimeStamp				//  Ͱ ϴ TIMESTAMP
+	//		BYTE	Count					//  
+	//		{
+	//			BYTE	DataType
+	//			int		DataValue
+	//		}	* Count
+	//	}
+	//
+	//------------------------------------------------------------
+	en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE_BATCH,
+
+	//------------------------------------------------------------
+	// ͸ Ŭ̾Ʈ()    Ÿ 
+	// α     ,   üѴ ( )
+	//       ͸ ޴´
+	//
+	//	{
+	//		WORD	Type
+	//
+	//		UINT64	DataTypeMask			//   ŸԵ, (1 << dfMONITOR_DATA_TYPE_xxx)  
+	//		BYTE	ServerCount				//   , 0 ̸  
+	//		{
+	//			BYTE	ServerNo
+	//		}	* ServerCount
+	//	}
+	//
+	//------------------------------------------------------------
+	en_PACKET_CS_MONITOR_TOOL_REQ_SUBSCRIBE,
+
 
 };
 
@@ -162,4 +220,11 @@ enum en_PACKET_CS_MONITOR_TOOL_RES_LOGIN
 	dfMONITOR_TOOL_LOGIN_OK = 1,		// α 
 	dfMONITOR_TOOL_LOGIN_ERR_NOSERVER = 2,		// ̸  (Ī̽)
 	dfMONITOR_TOOL_LOGIN_ERR_SESSIONKEY = 3,		// α Ű 
+};
+
+
+
+enum en_PACKET_CS_MONITOR_TOOL_CAPABILITY
+{
+	dfMONITOR_TOOL_CAPABILITY_BATCH = 0x01,		// en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE_BATCH  
 };
\ No newline at end of file
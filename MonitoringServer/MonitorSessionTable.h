@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstdint>
+#include <Windows.h>
+
+#include "NetLibrary/Logger/Logger.h"
+
+////////////////////////////////////////////////
+//  Ű( ID  32Ʈ) εϴ Ǻ  ̺
+//  ĭ [ 32bit][ 8bit][ ȣ 8bit]  64bit  ̶   б/CAS ٷ
+//   ID  32Ʈ(Accept )̸, 밡 ٸ  IDδ ĭ аų ٲ  
+//
+// NetServer  Ű OnRelease ȣ  ݳϹǷ,  Ű    OnAccept   OnRelease    ִ
+//   OnAccept ĭ Ѱܹ鼭    ְ, ʰ  OnRelease 밡 ޶ ƹ͵  ʴ´
+////////////////////////////////////////////////
+class MonitorSessionTable
+{
+public:
+    enum class ERole : uint8_t
+    {
+        None = 0,   //  ĭ
+        Unknown,    //   α 
+        Client,     // ͸ Ŭ̾Ʈ()
+        Server      // ͸  ִ 
+    };
+
+    MonitorSessionTable(void) = default;
+
+    ~MonitorSessionTable(void)
+    {
+        delete[] mSlots;
+    }
+
+    MonitorSessionTable(const MonitorSessionTable& other) = delete;
+    MonitorSessionTable& operator=(const MonitorSessionTable& other) = delete;
+
+    //  Ű ŭ  ĭ  (NetServer::Start  ȣ, ̶  ĭ )
+    void Init(const uint32_t maxSessionCount)
+    {
+        delete[] mSlots;
+
+        mSlots = new Slot[maxSessionCount]{};
+        mSlotCount = maxSessionCount;
+        mUnknownCount = 0;
+        mServerCount = 0;
+    }
+
+    inline uint32_t GetUnknownCount(void) const { return mUnknownCount; }
+    inline uint32_t GetServerCount(void) const { return mServerCount; }
+
+    //   Unknown Ѵ
+    //   OnRelease   ʾҴٸ   ID  ش (ٸ ERole::None)
+    ERole Accept(const uint64_t sessionID, uint64_t* outPrevSessionID)
+    {
+        Slot& slot = getSlot(sessionID);
+
+        const uint64_t prevState = static_cast<uint64_t>(InterlockedExchange64(&slot.State, static_cast<LONG64>(makeState(sessionID, ERole::Unknown, 0))));
+
+        InterlockedIncrement(&mUnknownCount);
+
+        const ERole prevRole = getRole(prevState);
+
+        if (prevRole != ERole::None)
+        {
+            onRoleRemoved(prevRole);
+            *outPrevSessionID = makeSessionID(getSessionKey(sessionID), prevState);
+        }
+
+        return prevRole;
+    }
+
+    // Unknown   Ѵ (̹ α߰ų  ̶ false)
+    bool Login(const uint64_t sessionID, const ERole role, const uint8_t serverNo)
+    {
+        Slot& slot = getSlot(sessionID);
+
+        const uint64_t unknownState = makeState(sessionID, ERole::Unknown, 0);
+
+        if (static_cast<uint64_t>(InterlockedCompareExchange64(&slot.State, static_cast<LONG64>(makeState(sessionID, role, serverNo)), static_cast<LONG64>(unknownState))) != unknownState)
+        {
+            return false;
+        }
+
+        InterlockedDecrement(&mUnknownCount);
+
+        if (role == ERole::Server)
+        {
+            InterlockedIncrement(&mServerCount);
+        }
+
+        return true;
+    }
+
+    // ĭ    ش (̹ ٸ  ĭ Ѱܹ޾Ҵٸ ERole::None)
+    ERole Release(const uint64_t sessionID)
+    {
+        Slot& slot = getSlot(sessionID);
+
+        uint64_t state = slot.State;
+
+        for (;;)
+        {
+            if (getRole(state) == ERole::None || false == isSameGeneration(state, sessionID))
+            {
+                return ERole::None;
+            }
+
+            const uint64_t prevState = static_cast<uint64_t>(InterlockedCompareExchange64(&slot.State, 0, static_cast<LONG64>(state)));
+
+            if (prevState == state)
+            {
+                break;
+            }
+
+            state = prevState;
+        }
+
+        const ERole role = getRole(state);
+
+        onRoleRemoved(role);
+
+        return role;
+    }
+
+    //    (ٸ   ID ERole::None)
+    inline ERole GetRole(const uint64_t sessionID) const
+    {
+        const uint64_t state = getSlot(sessionID).State;
+
+        return isSameGeneration(state, sessionID) ? getRole(state) : ERole::None;
+    }
+
+    // α  ȣ ã´ ( α  ƴ϶ false)
+    inline bool FindServerNo(const uint64_t sessionID, int32_t* outServerNo) const
+    {
+        const uint64_t state = getSlot(sessionID).State;
+
+        if (false == isSameGeneration(state, sessionID) || getRole(state) != ERole::Server)
+        {
+            return false;
+        }
+
+        *outServerNo = static_cast<int32_t>(state & 0xFF);
+
+        return true;
+    }
+
+private:
+
+    struct Slot
+    {
+        volatile LONG64 State;      // [ 32bit][ 8bit][ ȣ 8bit] (0̸  ĭ)
+    };
+
+    inline Slot& getSlot(const uint64_t sessionID) const
+    {
+        const uint32_t sessionKey = getSessionKey(sessionID);
+
+        ASSERT_LIVE(sessionKey < mSlotCount, L"MonitorSessionTable invalid session key");
+
+        return mSlots[sessionKey];
+    }
+
+    void onRoleRemoved(const ERole role)
+    {
+        if (role == ERole::Unknown)
+        {
+            InterlockedDecrement(&mUnknownCount);
+        }
+        else if (role == ERole::Server)
+        {
+            InterlockedDecrement(&mServerCount);
+        }
+    }
+
+    static inline uint32_t getSessionKey(const uint64_t sessionID) { return static_cast<uint32_t>(sessionID >> 32); }
+
+    static inline uint64_t makeState(const uint64_t sessionID, const ERole role, const uint8_t serverNo)
+    {
+        return (sessionID << 32) | (static_cast<uint64_t>(role) << 8) | serverNo;
+    }
+
+    static inline ERole getRole(const uint64_t state) { return static_cast<ERole>((state >> 8) & 0xFF); }
+
+    static inline bool isSameGeneration(const uint64_t state, const uint64_t sessionID) { return static_cast<uint32_t>(state >> 32) == static_cast<uint32_t>(sessionID); }
+
+    static inline uint64_t makeSessionID(const uint32_t sessionKey, const uint64_t state) { return (static_cast<uint64_t>(sessionKey) << 32) | (state >> 32); }
+
+private:
+
+    Slot*               mSlots = nullptr;   // [ Ű]
+    uint32_t            mSlotCount = 0;
+    volatile LONG       mUnknownCount = 0;
+    volatile LONG       mServerCount = 0;
+};
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <bitset>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "MonitorProtocol.h"
+
+////////////////////////////////////////////////
+// ͸ Ŭ̾Ʈ  ( ȣ  +  Ÿ Ʈũ) ׷κ ̸   
+//  ڷδ ٲ ʴ ̴ -  ٲ (α,  û,  )  ̺  RcuPointer ° üѴ
+// εĳƮ   (, Ÿ)   ״ SendPacketMulti ѱ
+//  ϵ ϳ ӵ 迭 (, Ÿ)  ̾ ̰ ĭ  ġ д
+////////////////////////////////////////////////
+class MonitorSubscriberTable
+{
+public:
+    enum
+    {
+        MAX_SERVER_NO = 256,    //  ȣ BYTE ۵ǹǷ 0 ~ 255
+        MAX_DATA_TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::MAX
+    };
+
+    static_assert(MAX_DATA_TYPE <= 64, "data type mask must fit in 64 bits");
+
+    // ȿ  Ÿ (1 ~ MAX_DATA_TYPE - 1) Ʈ  ũ
+    static constexpr uint64_t ALL_DATA_TYPES = ((MAX_DATA_TYPE == 64) ? ~0ull : ((1ull << MAX_DATA_TYPE) - 1)) & ~1ull;
+
+    struct Subscription
+    {
+        std::bitset<MAX_SERVER_NO>  Servers;        //   ȣ
+        uint64_t                    DataTypeMask;   //   ŸԵ (1 << dataType)
+        bool                        bBatch;         // ġ ޼   ִ Ŭ̾Ʈ
+    };
+
+    using SubscriptionMap = std::unordered_map<uint64_t, Subscription>;
+
+    //   (̺ ִ  ȿ)
+    struct SessionList
+    {
+        const uint64_t* Sessions;
+        uint32_t        Count;
+    };
+
+    //      Ÿ ũ  ġ Ŭ̾Ʈ
+    // ġ ϳ ũ   ɷ  ü 
+    struct BatchGroup
+    {
+        uint64_t                DataTypeMask;
+        std::vector<uint64_t>   Sessions;
+    };
+
+    // κ   
+    explicit MonitorSubscriberTable(SubscriptionMap subscriptions) : mSubscriptions(std::move(subscriptions)), mBatchGroups(MAX_SERVER_NO)
+    {
+        for (auto& [sessionID, subscription] : mSubscriptions)
+        {
+            subscription.DataTypeMask &= ALL_DATA_TYPES;
+
+            if (subscription.bBatch)
+            {
+                mBatchClientCount++;
+            }
+        }
+
+        buildLists();
+    }
+
+    MonitorSubscriberTable(const MonitorSubscriberTable& other) = delete;
+    MonitorSubscriberTable& operator=(const MonitorSubscriberTable& other) = delete;
+
+    //     Ÿ  ( û   Ŭ̾Ʈ ⺻)
+    static Subscription SubscribeAll(const bool bBatch)
+    {
+        Subscription subscription;
+        subscription.Servers.set();
+        subscription.DataTypeMask = ALL_DATA_TYPES;
+        subscription.bBatch = bBatch;
+
+        return subscription;
+    }
+
+    //  ̺   
+    inline const SubscriptionMap& GetSubscriptions(void) const { return mSubscriptions; }
+
+    //   ´ (α Ŭ̾Ʈ ƴ϶ false)
+    bool Find(const uint64_t sessionID, Subscription* outSubscription) const
+    {
+        auto it = mSubscriptions.find(sessionID);
+
+        if (it == mSubscriptions.end())
+        {
+            return false;
+        }
+
+        *outSubscription = it->second;
+
+        return true;
+    }
+
+    inline uint32_t GetClientCount(void) const { return static_cast<uint32_t>(mSubscriptions.size()); }
+    inline uint32_t GetBatchClientCount(void) const { return mBatchClientCount; }
+
+    // (serverNo, dataType)   Ŭ̾Ʈ
+    inline SessionList GetSubscribers(const uint32_t serverNo, const uint32_t dataType) const { return mAll.Get(serverNo * MAX_DATA_TYPE + dataType); }
+
+    //   ġ ޼  ϴ Ŭ̾Ʈ
+    inline SessionList GetLegacySubscribers(const uint32_t serverNo, const uint32_t dataType) const { return mLegacy.Get(serverNo * MAX_DATA_TYPE + dataType); }
+
+    // serverNo  ġ Ŭ̾Ʈ 
+    inline const std::vector<BatchGroup>& GetBatchGroups(const uint32_t serverNo) const { return mBatchGroups[serverNo]; }
+
+private:
+
+    // ĭ ϵ ̾  迭 - ĭ i  Sessions[Offsets[i], Offsets[i + 1])
+    struct CompactLists
+    {
+        std::vector<uint32_t>   Offsets;
+        std::vector<uint64_t>   Sessions;
+
+        inline SessionList Get(const uint32_t cellIndex) const
+        {
+            return { Sessions.data() + Offsets[cellIndex], Offsets[cellIndex + 1] - Offsets[cellIndex] };
+        }
+    };
+
+    //  (serverNo, dataType) ĭ鸶 func(cellIndex) ȣ
+    template <typename Func>
+    static void forEachSubscribedCell(const Subscription& subscription, Func&& func)
+    {
+        if (subscription.DataTypeMask == 0)
+        {
+            return;
+        }
+
+        for (uint32_t serverNo = 0; serverNo < MAX_SERVER_NO; ++serverNo)
+        {
+            if (false == subscription.Servers.test(serverNo))
+            {
+                continue;
+            }
+
+            for (uint32_t dataType = 1; dataType < MAX_DATA_TYPE; ++dataType)
+            {
+                if (subscription.DataTypeMask & (1ull << dataType))
+                {
+                    func(serverNo * MAX_DATA_TYPE + dataType);
+                }
+            }
+        }
+    }
+
+    // ĭ     ġ ϰ, ٽ 鼭 ä
+    void buildLists(void)
+    {
+        constexpr uint32_t CELL_COUNT = MAX_SERVER_NO * MAX_DATA_TYPE;
+
+        mAll.Offsets.assign(CELL_COUNT + 1, 0);
+        mLegacy.Offsets.assign(CELL_COUNT + 1, 0);
+
+        for (const auto& [sessionID, subscription] : mSubscriptions)
+        {
+            const bool bLegacy = (false == subscription.bBatch);
+
+            forEachSubscribedCell(subscription, [this, bLegacy](const uint32_t cellIndex)
+                {
+                    mAll.Offsets[cellIndex + 1]++;
+
+                    if (bLegacy)
+                    {
+                        mLegacy.Offsets[cellIndex + 1]++;
+                    }
+                });
+        }
+
+        for (uint32_t i = 0; i < CELL_COUNT; ++i)
+        {
+            mAll.Offsets[i + 1] += mAll.Offsets[i];
+            mLegacy.Offsets[i + 1] += mLegacy.Offsets[i];
+        }
+
+        mAll.Sessions.resize(mAll.Offsets[CELL_COUNT]);
+        mLegacy.Sessions.resize(mLegacy.Offsets[CELL_COUNT]);
+
+        std::vector<uint32_t> allFilled(mAll.Offsets.begin(), mAll.Offsets.end() - 1);
+        std::vector<uint32_t> legacyFilled(mLegacy.Offsets.begin(), mLegacy.Offsets.end() - 1);
+
+        for (const auto& [sessionID, subscription] : mSubscriptions)
+        {
+            const uint64_t id = sessionID;
+            const bool bLegacy = (false == subscription.bBatch);
+
+            forEachSubscribedCell(subscription, [&, id, bLegacy](const uint32_t cellIndex)
+                {
+                    mAll.Sessions[allFilled[cellIndex]++] = id;
+
+                    if (bLegacy)
+                    {
+                        mLegacy.Sessions[legacyFilled[cellIndex]++] = id;
+                    }
+                });
+
+            if (subscription.bBatch && subscription.DataTypeMask != 0)
+            {
+                for (uint32_t serverNo = 0; serverNo < MAX_SERVER_NO; ++serverNo)
+                {
+                    if (subscription.Servers.test(serverNo))
+                    {
+                        addToBatchGroup(mBatchGroups[serverNo], subscription.DataTypeMask, sessionID);
+                    }
+                }
+            }
+        }
+    }
+
+    static void addToBatchGroup(std::vector<BatchGroup>& groups, const uint64_t dataTypeMask, const uint64_t sessionID)
+    {
+        for (BatchGroup& group : groups)
+        {
+            if (group.DataTypeMask == dataTypeMask)
+            {
+                group.Sessions.push_back(sessionID);
+                return;
+            }
+        }
+
+        groups.push_back({ dataTypeMask, { sessionID } });
+    }
+
+private:
+
+    SubscriptionMap                         mSubscriptions;         // α ͸ Ŭ̾Ʈ -> 
+    uint32_t                                mBatchClientCount = 0;
+
+    CompactLists                            mAll;                   // [serverNo * MAX_DATA_TYPE + dataType]  
+    CompactLists                            mLegacy;                // [serverNo * MAX_DATA_TYPE + dataType] ġ 𸣴  
+    std::vector<std::vector<BatchGroup>>    mBatchGroups;           // [serverNo] ġ Ŭ̾Ʈ 
+};
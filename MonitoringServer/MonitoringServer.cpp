@@ -1,34 +1,34 @@
 #include "MonitoringServer.h"
 
+#include "MonitorPacket.h"
 #include "MonitorProtocol.h"
 #include "NetLibrary/Logger/Logger.h"
 
 #include <Psapi.h>
 #include <strsafe.h>
 #include <process.h>
+#include <vector>
 
 
 #pragma comment(lib,"Pdh.lib")
 
 void MonitoringServer::Start(const uint16_t port, const uint32_t maxSessionCount, const uint32_t iocpConcurrentThreadCount, const uint32_t iocpWorkerThreadCount)
 {
-	NetServer::Start(port, maxSessionCount, iocpConcurrentThreadCount, iocpWorkerThreadCount);
+	// Accept ۵Ǳ   Ű ĭ  д
+	mSessions.Init(maxSessionCount);
 
-	if (mLogDBWriteIntervalMinutes > 0)
+	// α ŸӾƿ üũ   ĭ ϴ Ÿ̸ ٷ 
+	if (mTimeoutCheckInterval > 0)
 	{
-		if (false == mDBConnection.Connect())
-		{
-			LOGF(ELogLevel::Assert, L"DB Connect Failed (error = %d)", mDBConnection.GetLastError());
-			CrashDump::Crash();
-			return;
-		}
-
-		LOGF(ELogLevel::System, L"DB successfully Connected");
+		mLoginTimers.Init(maxSessionCount, mTimeoutCheckInterval);
 	}
 
-	for (int i = 0; i < en_PACKET_SS_MONITOR_DATA_UPDATE::MAX; ++i)
+	NetServer::Start(port, maxSessionCount, iocpConcurrentThreadCount, iocpWorkerThreadCount);
+
+	// DB  mLogWriter  尡 õѴ (DB   )
+	if (mLogDBWriteIntervalMinutes > 0)
 	{
-		mMonitorInfos[i].Min = INT_MAX;
+		mLogWriter.Start();
 	}
 
 	mMachineMonitorThread = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, machineMonitorThread, this, 0, nullptr));
@@ -73,6 +73,16 @@ void MonitoringServer::Start(const uint16_t port, const uint32_t maxSessionCount
 		::SetWaitableTimer(mTimeoutCheckEvent, &timeoutCheckEventTimerTime, mTimeoutCheckInterval, nullptr, nullptr, FALSE);
 
 	}
+
+	if (mHistory.GetHistorySeconds() > 0)
+	{
+		mBackfillRequests.Init(BACKFILL_REQUEST_QUEUE_SIZE);
+
+		mBackfillEvent = ::CreateEvent(NULL, FALSE, FALSE, NULL);
+		ASSERT_LIVE(mBackfillEvent != NULL, L"mBackfillEvent create failed");
+
+		mBackfillThread = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, backfillThread, this, 0, nullptr));
+	}
 	
 	mbIsRunning = true;
 }
@@ -90,7 +100,9 @@ void MonitoringServer::Shutdown(void)
 		::WaitForSingleObject(mLogDBWriteThread, INFINITE);
 		::CloseHandle(mLogDBWriteThread);
 		::CloseHandle(mLogDBWriteEvent);
-		mDBConnection.Disconnect();
+
+		// ť  ġ ϰ DB  ´
+		mLogWriter.Stop();
 	}
 
 	if (mTimeoutCheckInterval > 0)
@@ -100,6 +112,13 @@ void MonitoringServer::Shutdown(void)
 		::CloseHandle(mTimeoutCheckEvent);
 	}
 
+	if (mHistory.GetHistorySeconds() > 0)
+	{
+		::WaitForSingleObject(mBackfillThread, INFINITE);
+		::CloseHandle(mBackfillThread);
+		::CloseHandle(mBackfillEvent);
+	}
+
 	::CloseHandle(mMachineMonitorThread);
 	::CloseHandle(mShutdownEvent);
 	::CloseHandle(mMachineMonitorEvent);
@@ -109,66 +128,116 @@ void MonitoringServer::Shutdown(void)
 
 void MonitoringServer::OnAccept(const uint64_t sessionID)
 {
-	mUnknownsLock.lock();
-	mUnknowns.insert(std::make_pair(sessionID, ::timeGetTime()));
-	mUnknownsLock.unlock();
+	uint64_t prevSessionID;
+
+	const MonitorSessionTable::ERole prevRole = mSessions.Accept(sessionID, &prevSessionID);
+
+	//   Ű ɷִ   Ÿ̸Ӵ 
+	if (mTimeoutCheckInterval > 0)
+	{
+		mLoginTimers.Schedule(sessionID, mMaxTimeout);
+	}
+
+	//   Ű    OnRelease  Դ -    ⼭ Ѵ
+	if (prevRole != MonitorSessionTable::ERole::None)
+	{
+		onSessionRoleReleased(prevSessionID, prevRole);
+	}
 }
 
 void MonitoringServer::OnReceive(const uint64_t sessionID, Serializer* packet)
 {
-	WORD messageType;
+	uint16_t messageType;
 
-	*packet >> messageType;
+	if (false == PeekPacketType(packet, &messageType))
+	{
+		Disconnect(sessionID);
+		Serializer::Free(packet);
+		return;
+	}
 
+	// ޼ ̸   Ȯϰ  ° Ѵ (̰    )
 	switch (messageType)
 	{
-	case en_PACKET_TYPE::en_PACKET_CS_MONITOR_TOOL_REQ_LOGIN:
+	case MonitorPacket::CS_MONITOR_TOOL_REQ_LOGIN::TYPE:
 	{
-		char loginSessionKey[32]{};
+		// Capability  αΰ   ( ) α ̷ Ѵ
+		MonitorPacket::CS_MONITOR_TOOL_REQ_LOGIN_EX message;
 
-		constexpr uint32_t PACKET_SIZE = sizeof(messageType) + sizeof(loginSessionKey);
-		if (packet->GetUseSize() != PACKET_SIZE)
+		if (PacketSchema<MonitorPacket::CS_MONITOR_TOOL_REQ_LOGIN_EX>::IsValidSize(packet))
+		{
+			PacketSchema<MonitorPacket::CS_MONITOR_TOOL_REQ_LOGIN_EX>::Decode(packet, &message);
+		}
+		else
+		{
+			MonitorPacket::CS_MONITOR_TOOL_REQ_LOGIN legacyMessage;
+
+			if (false == PacketSchema<MonitorPacket::CS_MONITOR_TOOL_REQ_LOGIN>::Decode(packet, &legacyMessage))
+			{
+				Disconnect(sessionID);
+				break;
+			}
+
+			memcpy(message.LoginSessionKey, legacyMessage.LoginSessionKey, sizeof(message.LoginSessionKey));
+			message.Capability = 0;
+		}
+
+		process_CS_MONITOR_TOOL_REQ_LOGIN(sessionID, message.LoginSessionKey, message.Capability);
+	}
+	break;
+	case MonitorPacket::CS_MONITOR_TOOL_REQ_SUBSCRIBE::TYPE:
+	{
+		MonitorPacket::CS_MONITOR_TOOL_REQ_SUBSCRIBE header;
+		const MonitorPacket::SUBSCRIBE_SERVER_ENTRY* servers;
+
+		if (false == MonitorPacket::CS_MONITOR_TOOL_REQ_SUBSCRIBE_SCHEMA::Decode(packet, &header, &servers))
 		{
 			Disconnect(sessionID);
 			break;
 		}
 
-		packet->GetByte((char*)loginSessionKey, sizeof(loginSessionKey));
-
-		process_CS_MONITOR_TOOL_REQ_LOGIN(sessionID, loginSessionKey);
+		process_CS_MONITOR_TOOL_REQ_SUBSCRIBE(sessionID, header.DataTypeMask, servers, header.Count);
 	}
 	break;
-	case en_PACKET_TYPE::en_PACKET_SS_MONITOR_LOGIN:
+	case MonitorPacket::SS_MONITOR_LOGIN::TYPE:
 	{
-		int serverNo;
+		MonitorPacket::SS_MONITOR_LOGIN message;
 
-		constexpr uint32_t PACKET_SIZE = sizeof(messageType) + sizeof(serverNo);
-		if (packet->GetUseSize() != PACKET_SIZE)
+		if (false == PacketSchema<MonitorPacket::SS_MONITOR_LOGIN>::Decode(packet, &message))
 		{
 			Disconnect(sessionID);
 			break;
 		}
 
-		*packet >> serverNo;
-		process_SS_MONITOR_LOGIN(sessionID, serverNo);
+		process_SS_MONITOR_LOGIN(sessionID, message.ServerNo);
 	}
 	break;
-	case en_PACKET_TYPE::en_PACKET_SS_MONITOR_DATA_UPDATE:
+	case MonitorPacket::SS_MONITOR_DATA_UPDATE::TYPE:
 	{
-		BYTE dataType;
-		int dataValue;
-		int timeStamp;
+		MonitorPacket::SS_MONITOR_DATA_UPDATE message;
 
-		constexpr uint32_t PACKET_SIZE = sizeof(messageType) + sizeof(dataType) + sizeof(dataValue) + sizeof(timeStamp);
-		if (packet->GetUseSize() != PACKET_SIZE)
+		if (false == PacketSchema<MonitorPacket::SS_MONITOR_DATA_UPDATE>::Decode(packet, &message))
 		{
 			Disconnect(sessionID);
 			break;
 		}
 
-		*packet >> dataType >> dataValue >> timeStamp;
+		process_SS_MONITOR_DATA_UPDATE(sessionID, message.DataType, message.DataValue, message.TimeStamp);
+	}
+	break;
+	case MonitorPacket::SS_MONITOR_DATA_UPDATE_BATCH::TYPE:
+	{
+		MonitorPacket::SS_MONITOR_DATA_UPDATE_BATCH header;
+		const MonitorPacket::DATA_UPDATE_ENTRY* entries;
+
+		if (false == MonitorPacket::SS_MONITOR_DATA_UPDATE_BATCH_SCHEMA::Decode(packet, &header, &entries))
+		{
+			Disconnect(sessionID);
+			break;
+		}
 
-		process_SS_MONITOR_DATA_UPDATE(sessionID, dataType, dataValue, timeStamp);
+		// entries packet ۸ ŰǷ Free  ó 
+		process_SS_MONITOR_DATA_UPDATE_BATCH(sessionID, header.TimeStamp, entries, header.Count);
 	}
 	break;
 	default:
@@ -180,57 +249,103 @@ void MonitoringServer::OnReceive(const uint64_t sessionID, Serializer* packet)
 
 void MonitoringServer::OnRelease(const uint64_t sessionID)
 {
-	mUnknownsLock.lock();
-	mUnknowns.erase(sessionID);
-	mUnknownsLock.unlock();
+	if (mTimeoutCheckInterval > 0)
+	{
+		mLoginTimers.Cancel(sessionID);
+	}
 
-	mClientsLock.lock();
-	mClients.remove(sessionID);
-	mClientsLock.unlock();
+	//   Ű   ̹ Դٸ OnAccept Ƿ ERole::None
+	onSessionRoleReleased(sessionID, mSessions.Release(sessionID));
+}
 
-	mServersLock.lock();
-	mServers.erase(sessionID);
-	mServersLock.unlock();
+void MonitoringServer::onSessionRoleReleased(const uint64_t sessionID, const MonitorSessionTable::ERole role)
+{
+	if (role == MonitorSessionTable::ERole::Client)
+	{
+		publishSubscription(sessionID, nullptr);
+	}
 }
 
-Serializer* MonitoringServer::Create_CS_MONITOR_TOOL_RES_LOGIN(const BYTE status)
+void MonitoringServer::publishSubscription(const uint64_t sessionID, const MonitorSubscriberTable::Subscription* subscription)
 {
-	Serializer* packet = Serializer::Alloc();
+	mSubscribersWriteLock.lock();
+
+	// ü   ȿ ϾǷ  ̺ д   ʴ´
+	MonitorSubscriberTable::SubscriptionMap subscriptions = mSubscribers.Read()->GetSubscriptions();
 
-	*packet << (WORD)en_PACKET_CS_MONITOR_TOOL_RES_LOGIN << status;
+	if (subscription != nullptr)
+	{
+		subscriptions[sessionID] = *subscription;
+	}
+	else
+	{
+		subscriptions.erase(sessionID);
+	}
 
-	return packet;
+	//  ̺ Խϰ  ̺ д εĳƮ   ̺ 
+	mSubscribers.Publish(new MonitorSubscriberTable(std::move(subscriptions)));
+
+	mSubscribersWriteLock.unlock();
 }
 
-Serializer* MonitoringServer::Create_CS_MONITOR_TOOL_DATA_UPDATE(const BYTE serverNo, const BYTE dataType, const int dataValue, const int timeStamp)
+Serializer* MonitoringServer::Create_CS_MONITOR_TOOL_RES_LOGIN(const BYTE status)
 {
-	Serializer* packet = Serializer::Alloc();
-
-	*packet << (WORD)en_PACKET_CS_MONITOR_TOOL_DATA_UPDATE << serverNo << dataType << dataValue << timeStamp;
+	return PacketSchema<MonitorPacket::CS_MONITOR_TOOL_RES_LOGIN>::Encode({ status });
+}
 
-	return packet;
+Serializer* MonitoringServer::Create_CS_MONITOR_TOOL_DATA_UPDATE(const BYTE serverNo, const BYTE dataType, const int dataValue, const int timeStamp)
+{
+	return PacketSchema<MonitorPacket::CS_MONITOR_TOOL_DATA_UPDATE>::Encode({ serverNo, dataType, dataValue, timeStamp });
 }
 
-void MonitoringServer::process_CS_MONITOR_TOOL_REQ_LOGIN(const uint64_t sessionID, const char loginSessionKey[])
+Serializer* MonitoringServer::Create_CS_MONITOR_TOOL_DATA_UPDATE_BATCH(const BYTE serverNo, const int timeStamp, const MonitorPacket::DATA_UPDATE_ENTRY entries[], const uint32_t entryCount)
 {
-	mUnknownsLock.lock();
-	mUnknowns.erase(sessionID);
-	mUnknownsLock.unlock();
+	return MonitorPacket::CS_MONITOR_TOOL_DATA_UPDATE_BATCH_SCHEMA::Encode({ serverNo, timeStamp }, entries, entryCount);
+}
 
+void MonitoringServer::process_CS_MONITOR_TOOL_REQ_LOGIN(const uint64_t sessionID, const char loginSessionKey[], const BYTE capability)
+{
 	Serializer* CS_MONITOR_TOOL_RES_LOGIN;
 
 	if (0 == strncmp(loginSessionKey, LOGIN_SESSION_KEY, LOGIN_SESSION_KEY_LENGTH))
 	{
-		mClientsLock.lock();
-		mClients.push_back(sessionID);
-		mClientsLock.unlock();
+		if (false == mSessions.Login(sessionID, MonitorSessionTable::ERole::Client, 0))
+		{
+			LOGF(ELogLevel::System, L"client sessionID = %llu already logged in", sessionID);
+			Disconnect(sessionID);
+			return;
+		}
+
+		if (mTimeoutCheckInterval > 0)
+		{
+			mLoginTimers.Cancel(sessionID);
+		}
+
+		//  û      ͸ ޴´
+		const bool bBatch = (capability & en_PACKET_CS_MONITOR_TOOL_CAPABILITY::dfMONITOR_TOOL_CAPABILITY_BATCH) != 0;
+		const MonitorSubscriberTable::Subscription subscription = MonitorSubscriberTable::SubscribeAll(bBatch);
+
+		publishSubscription(sessionID, &subscription);
 
 		CS_MONITOR_TOOL_RES_LOGIN = Create_CS_MONITOR_TOOL_RES_LOGIN(en_PACKET_CS_MONITOR_TOOL_RES_LOGIN::dfMONITOR_TOOL_LOGIN_OK);
 		SendPacket(sessionID, CS_MONITOR_TOOL_RES_LOGIN);
+
+		// ֱ ͸    忡 ñ
+		if (mHistory.GetHistorySeconds() > 0)
+		{
+			if (mBackfillRequests.TryEnqueue(sessionID))
+			{
+				::SetEvent(mBackfillEvent);
+			}
+			else
+			{
+				LOGF(ELogLevel::System, L"client sessionID = %llu backfill request queue full", sessionID);
+			}
+		}
 	}
 	else
 	{
-		LOGF(ELogLevel::System, L"client sessionID = %llu login failed", sessionID);
+		LOGF_LIMITED(ELogLevel::System, SESSION_ERROR_LOGS_PER_SECOND, L"client sessionID = %llu login failed", sessionID);
 		CS_MONITOR_TOOL_RES_LOGIN = Create_CS_MONITOR_TOOL_RES_LOGIN(en_PACKET_CS_MONITOR_TOOL_RES_LOGIN::dfMONITOR_TOOL_LOGIN_ERR_SESSIONKEY);
 		SendAndDisconnect(sessionID, CS_MONITOR_TOOL_RES_LOGIN);
 	}
@@ -238,76 +353,195 @@ void MonitoringServer::process_CS_MONITOR_TOOL_REQ_LOGIN(const uint64_t sessionI
 	Serializer::Free(CS_MONITOR_TOOL_RES_LOGIN);
 }
 
+void MonitoringServer::process_CS_MONITOR_TOOL_REQ_SUBSCRIBE(const uint64_t sessionID, const uint64_t dataTypeMask, const MonitorPacket::SUBSCRIBE_SERVER_ENTRY servers[], const uint32_t serverCount)
+{
+	MonitorSubscriberTable::Subscription subscription;
+
+	//   Ŷ   ϳ óǹǷ α    Ǹ ٲ۴
+	if (mSessions.GetRole(sessionID) != MonitorSessionTable::ERole::Client || false == mSubscribers.Read()->Find(sessionID, &subscription))
+	{
+		LOGF(ELogLevel::System, L"sessionID = %llu subscribe before login", sessionID);
+		Disconnect(sessionID);
+		return;
+	}
+
+	subscription.DataTypeMask = dataTypeMask;
+	subscription.Servers.reset();
+
+	if (serverCount == 0)
+	{
+		subscription.Servers.set();
+	}
+
+	for (uint32_t i = 0; i < serverCount; i++)
+	{
+		subscription.Servers.set(servers[i].ServerNo);
+	}
+
+	publishSubscription(sessionID, &subscription);
+}
+
 void MonitoringServer::process_SS_MONITOR_LOGIN(const uint64_t sessionID, const int serverNo)
 {
-	mUnknownsLock.lock();
-	mUnknowns.erase(sessionID);
-	mUnknownsLock.unlock();
+	//  ȣ BYTE Ŭ̾Ʈ ޵Ǹ  ̺ ε δ
+	if (serverNo < 0 || serverNo >= MonitorAggregator::MAX_SERVER_NO)
+	{
+		LOGF(ELogLevel::System, L"sessionID = %llu invalid server number (%d)", sessionID, serverNo);
+		Disconnect(sessionID);
+		return;
+	}
+
+	if (false == mSessions.Login(sessionID, MonitorSessionTable::ERole::Server, static_cast<uint8_t>(serverNo)))
+	{
+		LOGF(ELogLevel::System, L"server sessionID = %llu already logged in", sessionID);
+		Disconnect(sessionID);
+		return;
+	}
 
-	mServersLock.lock();
-	mServers.insert(std::make_pair(sessionID, serverNo));
-	mServersLock.unlock();
+	if (mTimeoutCheckInterval > 0)
+	{
+		mLoginTimers.Cancel(sessionID);
+	}
 }
 
 void MonitoringServer::process_SS_MONITOR_DATA_UPDATE(const uint64_t sessionID, const BYTE dataType, const int dataValue, const int timeStamp)
 {
+	if (dataType == 0 || dataType >= en_PACKET_SS_MONITOR_DATA_UPDATE::MAX)
+	{
+		LOGF(ELogLevel::System, L"sessionID = %llu invalid data type (%d)", sessionID, dataType);
+		Disconnect(sessionID);
+		return;
+	}
+
 	int32_t serverNo;
 	
-	//  ȣ ã
+	if (false == findLoggedInServerNo(sessionID, &serverNo))
 	{
-		mServersLock.lock_shared();
+		return;
+	}
 
-		auto it = mServers.find(sessionID);
-		
-		if (it == mServers.end())
+	// յ ͸  
+	mAggregator.Add(serverNo, dataType, dataValue);
+
+	Broadcast_MONITOR_DATA_UPDATE(serverNo, dataType, dataValue, timeStamp);
+}
+
+void MonitoringServer::process_SS_MONITOR_DATA_UPDATE_BATCH(const uint64_t sessionID, const int timeStamp, const MonitorPacket::DATA_UPDATE_ENTRY entries[], const uint32_t entryCount)
+{
+	// ϳ ߸ Ÿ ִٸ ƹ͵ ݿ ʴ´
+	for (uint32_t i = 0; i < entryCount; i++)
+	{
+		const BYTE dataType = entries[i].DataType;
+
+		if (dataType == 0 || dataType >= en_PACKET_SS_MONITOR_DATA_UPDATE::MAX)
 		{
-			LOGF(ELogLevel::System, L"ID = %d, not logged in server sent received monitor data", sessionID);
+			LOGF(ELogLevel::System, L"sessionID = %llu invalid data type (%d) in batch", sessionID, dataType);
 			Disconnect(sessionID);
-			mServersLock.unlock_shared();
 			return;
 		}
+	}
+
+	int32_t serverNo;
 
-		serverNo = it->second;
+	//  ȣ ġ ü    ã´
+	if (false == findLoggedInServerNo(sessionID, &serverNo))
+	{
+		return;
+	}
 
-		mServersLock.unlock_shared();
+	if (entryCount == 0)
+	{
+		return;
 	}
 
 	// յ ͸  
+	for (uint32_t i = 0; i < entryCount; i++)
+	{
+		mAggregator.Add(serverNo, entries[i].DataType, entries[i].DataValue);
+	}
+
+	Broadcast_MONITOR_DATA_UPDATE_BATCH(serverNo, timeStamp, entries, entryCount);
+}
+
+bool MonitoringServer::findLoggedInServerNo(const uint64_t sessionID, int32_t* outServerNo)
+{
+	if (false == mSessions.FindServerNo(sessionID, outServerNo))
 	{
-		mMonitorInfos[dataType].Lock.lock();
+		LOGF_LIMITED(ELogLevel::System, SESSION_ERROR_LOGS_PER_SECOND, L"ID = %llu, not logged in server sent received monitor data", sessionID);
+		Disconnect(sessionID);
+		return false;
+	}
+
+	return true;
+}
+
+void MonitoringServer::Broadcast_MONITOR_DATA_UPDATE(const BYTE serverNo, const BYTE dataType, const int32_t value, const int32_t timeStamp)
+{
+	// Ŭ̾Ʈ ޴  ״ صΰ  α Ŭ̾Ʈ ش
+	mHistory.Record(serverNo, dataType, value, timeStamp);
+
+	auto subscriberTable = mSubscribers.Read();
+
+	const MonitorSubscriberTable::SessionList subscribers = subscriberTable->GetSubscribers(serverNo, dataType);
+
+	if (subscribers.Count > 0)
+	{
+		Serializer* CS_MONITOR_TOOL_DATA_UPDATE = Create_CS_MONITOR_TOOL_DATA_UPDATE(serverNo, dataType, value, timeStamp);
+		SendPacketMulti(subscribers.Sessions, subscribers.Count, CS_MONITOR_TOOL_DATA_UPDATE);
+		Serializer::Free(CS_MONITOR_TOOL_DATA_UPDATE);
+	}
+}
+
+void MonitoringServer::Broadcast_MONITOR_DATA_UPDATE_BATCH(const BYTE serverNo, const int32_t timeStamp, const MonitorPacket::DATA_UPDATE_ENTRY entries[], const uint32_t entryCount)
+{
+	ASSERT_LIVE(entryCount <= MonitorPacket::CS_MONITOR_TOOL_DATA_UPDATE_BATCH_SCHEMA::MAX_ENTRY_COUNT, L"Broadcast_MONITOR_DATA_UPDATE_BATCH entry count overflow");
+
+	for (uint32_t i = 0; i < entryCount; i++)
+	{
+		mHistory.Record(serverNo, entries[i].DataType, entries[i].DataValue, timeStamp);
+	}
+
+	auto subscriberTable = mSubscribers.Read();
+
+	//  Ÿ ũ  ġ Ŭ̾Ʈ   Ʈ ߷ Ŷ ϳ 
+	MonitorPacket::DATA_UPDATE_ENTRY filteredEntries[MonitorPacket::CS_MONITOR_TOOL_DATA_UPDATE_BATCH_SCHEMA::MAX_ENTRY_COUNT];
 
-		mMonitorInfos[dataType].ServerNo = serverNo;
-		mMonitorInfos[dataType].ValueSum += dataValue;
-		mMonitorInfos[dataType].Count++;
+	for (const MonitorSubscriberTable::BatchGroup& group : subscriberTable->GetBatchGroups(serverNo))
+	{
+		uint32_t filteredCount = 0;
 
-		if (dataValue < mMonitorInfos[dataType].Min)
+		for (uint32_t i = 0; i < entryCount; i++)
 		{
-			mMonitorInfos[dataType].Min = dataValue;
+			if (group.DataTypeMask & (1ull << entries[i].DataType))
+			{
+				filteredEntries[filteredCount++] = entries[i];
+			}
 		}
 
-		if (dataValue > mMonitorInfos[dataType].Max)
+		if (filteredCount == 0)
 		{
-			mMonitorInfos[dataType].Max = dataValue;
+			continue;
 		}
 
-		mMonitorInfos[dataType].Lock.unlock();
+		Serializer* CS_MONITOR_TOOL_DATA_UPDATE_BATCH = Create_CS_MONITOR_TOOL_DATA_UPDATE_BATCH(serverNo, timeStamp, filteredEntries, filteredCount);
+		SendPacketMulti(group.Sessions.data(), static_cast<uint32_t>(group.Sessions.size()), CS_MONITOR_TOOL_DATA_UPDATE_BATCH);
+		Serializer::Free(CS_MONITOR_TOOL_DATA_UPDATE_BATCH);
 	}
 
-	Broadcast_MONITOR_DATA_UPDATE(serverNo, dataType, dataValue, timeStamp);
-}
+	// ġ 𸣴 Ŭ̾ƮԴ Ʈ Ŷ (ڰ ִ ŸԸ )
+	for (uint32_t i = 0; i < entryCount; i++)
+	{
+		const MonitorSubscriberTable::SessionList legacySubscribers = subscriberTable->GetLegacySubscribers(serverNo, entries[i].DataType);
 
-void MonitoringServer::Broadcast_MONITOR_DATA_UPDATE(const BYTE serverNo, const BYTE dataType, const int32_t value, const int32_t timeStamp)
-{
-	Serializer* CS_MONITOR_TOOL_DATA_UPDATE = Create_CS_MONITOR_TOOL_DATA_UPDATE(serverNo, dataType, value, timeStamp);
+		if (legacySubscribers.Count == 0)
+		{
+			continue;
+		}
 
-	mClientsLock.lock_shared();
-	for (const uint64_t client : mClients)
-	{
-		SendPacket(client, CS_MONITOR_TOOL_DATA_UPDATE);
+		Serializer* CS_MONITOR_TOOL_DATA_UPDATE = Create_CS_MONITOR_TOOL_DATA_UPDATE(serverNo, entries[i].DataType, entries[i].DataValue, timeStamp);
+		SendPacketMulti(legacySubscribers.Sessions, legacySubscribers.Count, CS_MONITOR_TOOL_DATA_UPDATE);
+		Serializer::Free(CS_MONITOR_TOOL_DATA_UPDATE);
 	}
-	mClientsLock.unlock_shared();
-
-	Serializer::Free(CS_MONITOR_TOOL_DATA_UPDATE);
 }
 
 unsigned int MonitoringServer::machineMonitorThread(void* server)
@@ -435,272 +669,283 @@ unsigned int MonitoringServer::machineMonitorThread(void* server)
 		int networkSend = sendBytesSum / 1'000;
 		int availableMemory = availableMBytesValue.longValue;
 
-		monitoringServer->Broadcast_MONITOR_DATA_UPDATE(0, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_CPU_TOTAL, cpuTotal, timeStamp);
-		monitoringServer->Broadcast_MONITOR_DATA_UPDATE(0, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NONPAGED_MEMORY, nonpagedMemory, timeStamp);
-		monitoringServer->Broadcast_MONITOR_DATA_UPDATE(0, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_RECV, networkRecv, timeStamp);
-		monitoringServer->Broadcast_MONITOR_DATA_UPDATE(0, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_SEND, networkSend, timeStamp);
-		monitoringServer->Broadcast_MONITOR_DATA_UPDATE(0, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_AVAILABLE_MEMORY, availableMemory, timeStamp);
-
+		const MonitorPacket::DATA_UPDATE_ENTRY machineEntries[] =
 		{
-			constexpr int TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_CPU_TOTAL;
-
-			monitoringServer->mMonitorInfos[TYPE].Lock.lock();
-			monitoringServer->mMonitorInfos[TYPE].ServerNo = 10;
-			monitoringServer->mMonitorInfos[TYPE].ValueSum += cpuTotal;
-			monitoringServer->mMonitorInfos[TYPE].Count++;
-
-			if (cpuTotal < monitoringServer->mMonitorInfos[TYPE].Min)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Min = cpuTotal;
-			}
-
-			if (cpuTotal > monitoringServer->mMonitorInfos[TYPE].Max)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Max = cpuTotal;
-			}
+			{ en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_CPU_TOTAL, cpuTotal },
+			{ en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NONPAGED_MEMORY, nonpagedMemory },
+			{ en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_RECV, networkRecv },
+			{ en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_SEND, networkSend },
+			{ en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_AVAILABLE_MEMORY, availableMemory },
+		};
+
+		monitoringServer->Broadcast_MONITOR_DATA_UPDATE_BATCH(0, timeStamp, machineEntries, _countof(machineEntries));
+
+		monitoringServer->mAggregator.Add(MACHINE_SERVER_NO, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_CPU_TOTAL, cpuTotal);
+		monitoringServer->mAggregator.Add(MACHINE_SERVER_NO, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NONPAGED_MEMORY, nonpagedMemory);
+		monitoringServer->mAggregator.Add(MACHINE_SERVER_NO, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_RECV, networkRecv);
+		monitoringServer->mAggregator.Add(MACHINE_SERVER_NO, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_SEND, networkSend);
+		monitoringServer->mAggregator.Add(MACHINE_SERVER_NO, en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_AVAILABLE_MEMORY, availableMemory);
+	}
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.unlock();
-		}
+	LOGF(ELogLevel::System, L"Machine Monitor Thread End (ID : %d)", ::GetCurrentThreadId());
 
-		{
-			constexpr int TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NONPAGED_MEMORY;
+	return 0;
+}
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.lock();
-			monitoringServer->mMonitorInfos[TYPE].ServerNo = 10;
-			monitoringServer->mMonitorInfos[TYPE].ValueSum += nonpagedMemory;
-			monitoringServer->mMonitorInfos[TYPE].Count++;
+unsigned int MonitoringServer::logDBWriteThread(void* server)
+{
+	LOGF(ELogLevel::System, L"Log DB Write Thread Start (ID : %d)", ::GetCurrentThreadId());
 
-			if (nonpagedMemory < monitoringServer->mMonitorInfos[TYPE].Min)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Min = nonpagedMemory;
-			}
+	MonitoringServer* monitoringServer = reinterpret_cast<MonitoringServer*>(server);
 
-			if (nonpagedMemory > monitoringServer->mMonitorInfos[TYPE].Max)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Max = nonpagedMemory;
-			}
+	HANDLE waitEvents[2];
+	waitEvents[0] = monitoringServer->mShutdownEvent;
+	waitEvents[1] = monitoringServer->mLogDBWriteEvent;
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.unlock();
-		}
+	for (;;)
+	{
+		::WaitForMultipleObjects(2, waitEvents, FALSE, INFINITE);
 
+		if (false == monitoringServer->mbIsRunning)
 		{
-			constexpr int TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_RECV;
+			break;
+		}
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.lock();
-			monitoringServer->mMonitorInfos[TYPE].ServerNo = 10;
-			monitoringServer->mMonitorInfos[TYPE].ValueSum += networkRecv;
-			monitoringServer->mMonitorInfos[TYPE].Count++;
+		//  ̺  ٲٰ    (, Ÿ)  ϳ ġ  ⿡ ѱ
+		MonitorLogWriter::Batch batch;
+		batch.LogTime = static_cast<int64_t>(time(nullptr));
 
-			if (networkRecv < monitoringServer->mMonitorInfos[TYPE].Min)
+		monitoringServer->mAggregator.Drain([&batch](const uint32_t serverNo, const uint32_t dataType, const int32_t average, const int32_t max, const int32_t min)
 			{
-				monitoringServer->mMonitorInfos[TYPE].Min = networkRecv;
-			}
+				batch.Rows.push_back({ static_cast<int32_t>(serverNo), static_cast<int32_t>(dataType), average, max, min });
+			});
 
-			if (networkRecv > monitoringServer->mMonitorInfos[TYPE].Max)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Max = networkRecv;
-			}
+		const size_t rowCount = batch.Rows.size();
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.unlock();
+		if (rowCount == 0)
+		{
+			continue;
 		}
 
+		if (false == monitoringServer->mLogWriter.Push(std::move(batch)))
 		{
-			constexpr int TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_NETWORK_SEND;
-
-			monitoringServer->mMonitorInfos[TYPE].Lock.lock();
-			monitoringServer->mMonitorInfos[TYPE].ServerNo = 10;
-			monitoringServer->mMonitorInfos[TYPE].ValueSum += networkSend;
-			monitoringServer->mMonitorInfos[TYPE].Count++;
+			LOGF(ELogLevel::Error, L"LOG DB queue full, %zu rows dropped", rowCount);
+			continue;
+		}
 
-			if (networkSend < monitoringServer->mMonitorInfos[TYPE].Min)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Min = networkSend;
-			}
+		LOGF(ELogLevel::System, L"LOG DB QUEUED (%zu rows)", rowCount);
+	}
 
-			if (networkSend > monitoringServer->mMonitorInfos[TYPE].Max)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Max = networkSend;
-			}
+	LOGF(ELogLevel::System, L"Log DB Write Thread End (ID : %d)", ::GetCurrentThreadId());
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.unlock();
-		}
+	return 0;
+}
 
-		{
-			constexpr int TYPE = en_PACKET_SS_MONITOR_DATA_UPDATE::dfMONITOR_DATA_TYPE_MONITOR_AVAILABLE_MEMORY;
+unsigned int MonitoringServer::timeoutThread(void* server)
+{
+	LOGF(ELogLevel::System, L"Timeout Thread Start (ID : %d)", ::GetCurrentThreadId());
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.lock();
-			monitoringServer->mMonitorInfos[TYPE].ServerNo = 10;
-			monitoringServer->mMonitorInfos[TYPE].ValueSum += availableMemory;
-			monitoringServer->mMonitorInfos[TYPE].Count++;
+	MonitoringServer* monitoringServer = reinterpret_cast<MonitoringServer*>(server);
 
-			if (availableMemory < monitoringServer->mMonitorInfos[TYPE].Min)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Min = availableMemory;
-			}
+	HANDLE waitEvents[2];
+	waitEvents[0] = monitoringServer->mShutdownEvent;
+	waitEvents[1] = monitoringServer->mTimeoutCheckEvent;
 
-			if (availableMemory > monitoringServer->mMonitorInfos[TYPE].Max)
-			{
-				monitoringServer->mMonitorInfos[TYPE].Max = availableMemory;
-			}
+	for (;;)
+	{
+		::WaitForMultipleObjects(2, waitEvents, FALSE, INFINITE);
 
-			monitoringServer->mMonitorInfos[TYPE].Lock.unlock();
+		if (false == monitoringServer->mbIsRunning)
+		{
+			break;
 		}
+
+		//  üũ   Ÿ̸Ӹ , ݹ ̿ α߰ų   ҷ ɷ
+		monitoringServer->mLoginTimers.Advance([monitoringServer](const uint64_t sessionID)
+			{
+				if (monitoringServer->mSessions.GetRole(sessionID) == MonitorSessionTable::ERole::Unknown)
+				{
+					monitoringServer->Disconnect(sessionID);
+					LOGF_LIMITED(ELogLevel::System, SESSION_ERROR_LOGS_PER_SECOND, L"sessionID = %llu timeouted", sessionID);
+				}
+			});
 	}
 
-	LOGF(ELogLevel::System, L"Machine Monitor Thread End (ID : %d)", ::GetCurrentThreadId());
+	LOGF(ELogLevel::System, L"Timeout Thread End (ID : %d)", ::GetCurrentThreadId());
 
 	return 0;
 }
 
-unsigned int MonitoringServer::logDBWriteThread(void* server)
+unsigned int MonitoringServer::backfillThread(void* server)
 {
-	LOGF(ELogLevel::System, L"Log DB Write Thread Start (ID : %d)", ::GetCurrentThreadId());
+	LOGF(ELogLevel::System, L"Backfill Thread Start (ID : %d)", ::GetCurrentThreadId());
 
 	MonitoringServer* monitoringServer = reinterpret_cast<MonitoringServer*>(server);
 
 	HANDLE waitEvents[2];
 	waitEvents[0] = monitoringServer->mShutdownEvent;
-	waitEvents[1] = monitoringServer->mLogDBWriteEvent;
+	waitEvents[1] = monitoringServer->mBackfillEvent;
+
+	const uint32_t historySeconds = monitoringServer->mHistory.GetHistorySeconds();
+
+	std::vector<BackfillCursor> cursors;
+
+	//  α ǵ  ʿ ִ´ ( û  ð ),   ִٸ true
+	auto acceptRequests = [monitoringServer, historySeconds, &cursors](void)
+		{
+			bool bAccepted = false;
+			uint64_t sessionID;
+
+			while (monitoringServer->mBackfillRequests.TryDequeue(sessionID))
+			{
+				const int32_t endTimeStamp = static_cast<int32_t>(time(nullptr));
+				const int32_t beginTimeStamp = endTimeStamp - static_cast<int32_t>(historySeconds) + 1;
+
+				cursors.push_back({ sessionID, beginTimeStamp, endTimeStamp, 0, beginTimeStamp, 0, 0 });
+				bAccepted = true;
+			}
+
+			return bAccepted;
+		};
 
 	for (;;)
 	{
-		::WaitForMultipleObjects(2, waitEvents, FALSE, INFINITE);
+		//    ִٸ  Paused ٸ ̹Ƿ   ٽ ȮѴ
+		::WaitForMultipleObjects(2, waitEvents, FALSE, cursors.empty() ? INFINITE : BACKFILL_PACING_SLEEP_MS);
 
 		if (false == monitoringServer->mbIsRunning)
 		{
 			break;
 		}
 
-		time_t startTime = time(nullptr);
-		tm localTime;
-		localtime_s(&localTime, &startTime);
-
-		for (int i = 1; i < en_PACKET_SS_MONITOR_DATA_UPDATE::MAX; ++i)
-		{
-			int serverNo;
-			int valueSum;
-			int count;
-			int average;
-			int max;
-			int min;
-
-			{
-				monitoringServer->mMonitorInfos[i].Lock.lock();
-
-				serverNo = monitoringServer->mMonitorInfos[i].ServerNo;
-				valueSum = monitoringServer->mMonitorInfos[i].ValueSum;
-				count = monitoringServer->mMonitorInfos[i].Count;
-				max = monitoringServer->mMonitorInfos[i].Max;
-				min = monitoringServer->mMonitorInfos[i].Min;
+		acceptRequests();
 
-				monitoringServer->mMonitorInfos[i].ValueSum = 0;
-				monitoringServer->mMonitorInfos[i].Count = 0;
-				monitoringServer->mMonitorInfos[i].Max = 0;
-				monitoringServer->mMonitorInfos[i].Min = INT_MAX;
+		// Ǹ  ʾ ư ,    ƹ  ߴٸ ( Paused̰ų  ) ٸ
+		bool bSent;
 
-				monitoringServer->mMonitorInfos[i].Lock.unlock();
-			}
+		do
+		{
+			bSent = false;
 
-			if (count == 0)
-			{
-				average = 0;
-				max = 0;
-				min = 0;
-			}
-			else
+			for (size_t i = 0; i < cursors.size();)
 			{
-				average = valueSum / count; 
-			}
-			
-			bool querySuccess = false;
+				BackfillCursor& cursor = cursors[i];
+				const EBackfillStep step = monitoringServer->sendBackfillStep(&cursor);
 
-			while (true)
-			{
-				bool querySuccess = monitoringServer->mDBConnection.Query(L"INSERT INTO logdb.monitorlog_%04d%02d (`logtime`, `serverno`, `type`, `avr`, `max`, `min`) VALUES (NOW(), %d, %d, %d, %d, %d)", localTime.tm_year + 1900, localTime.tm_mon + 1, serverNo, i, average, max, min);
-				
-				if (querySuccess)
+				if (step == EBackfillStep::Completed || step == EBackfillStep::Aborted)
 				{
-					break;
+					LOGF(ELogLevel::System, L"client sessionID = %llu backfill %s (%u packets, %u values)", cursor.SessionID, (step == EBackfillStep::Completed) ? L"completed" : L"aborted", cursor.SentPacketCount, cursor.SentValueCount);
+					cursors.erase(cursors.begin() + i);
+					continue;
 				}
 
-				if (monitoringServer->mDBConnection.GetLastError() == 1146)
-				{
-					bool tableCreated = monitoringServer->mDBConnection.Query(L"CREATE TABLE logdb.monitorlog_%04d%02d LIKE logdb.monitorlog", localTime.tm_year + 1900, localTime.tm_mon + 1);
-
-					if (false == tableCreated)
-					{
-						LOGF(ELogLevel::Assert, L"CREATE TABLE Query Failed (error = %d)", monitoringServer->mDBConnection.GetLastError());
-						CrashDump::Crash();
-					}
-				}
-				else
+				if (step == EBackfillStep::Sent)
 				{
-					LOGF(ELogLevel::Assert, L"Query Failed (error = %d)", monitoringServer->mDBConnection.GetLastError());
-					CrashDump::Crash();
+					bSent = true;
 				}
+
+				++i;
 			}
-		}
 
-		LOGF(ELogLevel::System, L"LOG DB SAVED");
+			if (acceptRequests())
+			{
+				bSent = true;
+			}
+		} while (bSent && monitoringServer->mbIsRunning);
 	}
 
-	LOGF(ELogLevel::System, L"Log DB Write Thread End (ID : %d)", ::GetCurrentThreadId());
+	LOGF(ELogLevel::System, L"Backfill Thread End (ID : %d)", ::GetCurrentThreadId());
 
 	return 0;
 }
 
-unsigned int MonitoringServer::timeoutThread(void* server)
+MonitoringServer::EBackfillStep MonitoringServer::sendBackfillStep(BackfillCursor* cursor)
 {
-	LOGF(ELogLevel::System, L"Timeout Thread Start (ID : %d)", ::GetCurrentThreadId());
+	//  ʸ   ȮѴ ( ̿ ٲ   ʺ ݿ)
+	MonitorSubscriberTable::Subscription subscription;
 
-	MonitoringServer* monitoringServer = reinterpret_cast<MonitoringServer*>(server);
+	if (false == mbIsRunning || false == mSubscribers.Read()->Find(cursor->SessionID, &subscription))
+	{
+		return EBackfillStep::Aborted;
+	}
 
-	HANDLE waitEvents[2];
-	waitEvents[0] = monitoringServer->mShutdownEvent;
-	waitEvents[1] = monitoringServer->mTimeoutCheckEvent;
+	//  Ŭ̾Ʈ SendQueue ġ  ʵ  Ʒ   ŭ 
+	const uint32_t pauseSendQueueCount = GetSendQueueHighWater() / 2;
+	uint32_t sendQueueCount;
 
-	for (;;)
+	if (false == GetSendQueueCount(cursor->SessionID, &sendQueueCount))
 	{
-		::WaitForMultipleObjects(2, waitEvents, FALSE, INFINITE);
+		return EBackfillStep::Aborted;
+	}
 
-		if (false == monitoringServer->mbIsRunning)
-		{
-			break;
-		}
+	if (sendQueueCount >= pauseSendQueueCount)
+	{
+		return EBackfillStep::Paused;
+	}
+
+	uint32_t packetBudget = pauseSendQueueCount - sendQueueCount;
+
+	if (packetBudget > BACKFILL_PACKETS_PER_STEP)
+	{
+		packetBudget = BACKFILL_PACKETS_PER_STEP;
+	}
+
+	static_assert(MonitorHistory::MAX_DATA_TYPE <= MonitorPacket::CS_MONITOR_TOOL_DATA_UPDATE_BATCH_SCHEMA::MAX_ENTRY_COUNT, "a history row must fit in one batch message");
 
-		// ŸӾƿ ɸ ǵ
-		std::list<uint64_t> sessionToDisconnects;
+	MonitorPacket::DATA_UPDATE_ENTRY entries[MonitorHistory::MAX_DATA_TYPE];
 
+	for (; cursor->ServerNo < MonitorHistory::MAX_SERVER_NO; ++cursor->ServerNo, cursor->TimeStamp = cursor->BeginTimeStamp)
+	{
+		//  ʾҰų    ð  ʰ Ѿ
+		const uint64_t dataTypeMask = subscription.Servers.test(cursor->ServerNo) ? (subscription.DataTypeMask & mHistory.GetRecordedDataTypeMask(cursor->ServerNo)) : 0;
+
+		if (dataTypeMask == 0)
 		{
-			monitoringServer->mUnknownsLock.lock();
+			continue;
+		}
 
-			for (auto it = monitoringServer->mUnknowns.begin(); it != monitoringServer->mUnknowns.end(); ++it)
+		for (; cursor->TimeStamp <= cursor->EndTimeStamp; ++cursor->TimeStamp)
+		{
+			if (packetBudget == 0)
 			{
-				uint64_t sessionID = it->first;
-				uint64_t acceptTick = it->second;
+				return EBackfillStep::Sent;
+			}
 
-				if (::timeGetTime() - acceptTick >= monitoringServer->mMaxTimeout)
-				{
-					monitoringServer->Disconnect(sessionID);
-					sessionToDisconnects.push_back(sessionID);
-				}
+			const uint32_t entryCount = mHistory.ReadRow(cursor->ServerNo, dataTypeMask, cursor->TimeStamp, entries);
+
+			if (entryCount == 0)
+			{
+				continue;
 			}
 
-			for (const uint64_t sessionID : sessionToDisconnects)
+			const BYTE serverNo = static_cast<BYTE>(cursor->ServerNo);
+
+			if (subscription.bBatch)
 			{
-				monitoringServer->mUnknowns.erase(sessionID);
+				Serializer* CS_MONITOR_TOOL_DATA_UPDATE_BATCH = Create_CS_MONITOR_TOOL_DATA_UPDATE_BATCH(serverNo, cursor->TimeStamp, entries, entryCount);
+				SendPacket(cursor->SessionID, CS_MONITOR_TOOL_DATA_UPDATE_BATCH);
+				Serializer::Free(CS_MONITOR_TOOL_DATA_UPDATE_BATCH);
+
+				cursor->SentPacketCount++;
+				packetBudget--;
 			}
+			else
+			{
+				// ġ ޼  ϴ Ŭ̾Ʈ   ( ð  Ƿ     )
+				for (uint32_t i = 0; i < entryCount; ++i)
+				{
+					Serializer* CS_MONITOR_TOOL_DATA_UPDATE = Create_CS_MONITOR_TOOL_DATA_UPDATE(serverNo, entries[i].DataType, entries[i].DataValue, cursor->TimeStamp);
+					SendPacket(cursor->SessionID, CS_MONITOR_TOOL_DATA_UPDATE);
+					Serializer::Free(CS_MONITOR_TOOL_DATA_UPDATE);
+				}
 
-			monitoringServer->mUnknownsLock.unlock();
-		}
+				cursor->SentPacketCount += entryCount;
+				packetBudget = (entryCount < packetBudget) ? packetBudget - entryCount : 0;
+			}
 
-		for (const uint64_t sessionID : sessionToDisconnects)
-		{
-			LOGF(ELogLevel::System, L"sessionID = %llu timeouted", sessionID);
+			cursor->SentValueCount += entryCount;
 		}
 	}
 
-	LOGF(ELogLevel::System, L"Timeout Thread End (ID : %d)", ::GetCurrentThreadId());
-
-	return 0;
-}
\ No newline at end of file
+	return EBackfillStep::Completed;
+}
@@ -2,15 +2,21 @@
 
 #include "NetLibrary/NetServer/NetServer.h"
 
-#include <list>
-#include <map>
 #include <mutex>
-#include <shared_mutex>
 
 #include <Pdh.h>
 
+#include "MonitorAggregator.h"
+#include "MonitorHistory.h"
+#include "MonitorLogWriter.h"
+#include "MonitorPacket.h"
 #include "MonitorProtocol.h"
+#include "MonitorSessionTable.h"
+#include "MonitorSubscriberTable.h"
 #include "NetLibrary/DBConnector/DBConnector.h"
+#include "NetLibrary/DataStructure/MpscRingQueue.h"
+#include "NetLibrary/DataStructure/RcuPointer.h"
+#include "NetLibrary/DataStructure/TimerWheel.h"
 
 class MonitoringServer : public NetServer
 {
@@ -30,6 +36,12 @@ public: // 
     // DB   
     void SetDBConnectionInfo(const WCHAR* ip, const WCHAR* user, const WCHAR* password, const WCHAR* DBName, const uint32_t port) { mDBConnection.SetConnectionInfo(ip, user, password, DBName, port); }
 
+    // DB  ť ũ (ġ )  -  尡 и  ̻ ġ 
+    void SetLogDBQueueCapacity(const uint32_t batchCount) { mLogWriter.SetQueueCapacity(batchCount); }
+
+    // DB ְ spoolAfterSeconds ̻ ̾   ġ spoolFileName Ƶ״ٰ DB ƿ Ѵ
+    void SetLogDBSpool(const WCHAR* spoolFileName, const uint32_t spoolAfterSeconds) { mLogWriter.SetSpoolFileName(spoolFileName); mLogWriter.SetSpoolAfterSeconds(spoolAfterSeconds); }
+
     //  α  ǵ鿡  ŸӾƿ ð
     void SetMaxTimeout(uint32_t maxTimeout) { mMaxTimeout = maxTimeout; }
 
@@ -37,6 +49,10 @@ public: // 
     // 0̸ ŸӾƿ  
     void SetTimeoutCheckInterval(uint32_t timeoutCheckInterval) { mTimeoutCheckInterval = timeoutCheckInterval; }
 
+    // ֱ ͸    - α ͸ Ŭ̾Ʈ    ش
+    // historySeconds 0̸  
+    void SetHistory(const uint32_t historySeconds, const uint32_t memoryBudgetMB) { mHistory.Init(historySeconds, static_cast<uint64_t>(memoryBudgetMB) * 1024 * 1024); }
+
 public:
 
     //  
@@ -56,25 +72,41 @@ public:
 
 public: // 
 
-    uint32_t    GetUnknownSessionCount(void) { return static_cast<uint32_t>(mUnknowns.size()); }
-    uint32_t    GetConnectedClientCount(void) { return static_cast<uint32_t>(mClients.size()); }
-    uint32_t    GetConnectedServerCount(void) { return static_cast<uint32_t>(mServers.size()); }
+    uint32_t    GetUnknownSessionCount(void) { return mSessions.GetUnknownCount(); }
+    uint32_t    GetConnectedClientCount(void) { return mSubscribers.Read()->GetClientCount(); }
+    uint32_t    GetConnectedBatchClientCount(void) { return mSubscribers.Read()->GetBatchClientCount(); }
+    uint32_t    GetConnectedServerCount(void) { return mSessions.GetServerCount(); }
     uint32_t    GetLogDBWriteIntervalMinutes(void) { return mLogDBWriteIntervalMinutes; }
+    uint64_t    GetHistoryAllocatedBytes(void) const { return mHistory.GetAllocatedBytes(); }
+    uint32_t    GetHistoryRejectedCount(void) const { return mHistory.GetRejectedCount(); }
+    bool        IsLogDBAvailable(void) const { return mLogWriter.IsDBAvailable(); }
+    uint32_t    GetLogDBQueuedBatchCount(void) const { return mLogWriter.GetQueuedBatchCount(); }
+    uint32_t    GetLogDBSpooledBatchCount(void) const { return mLogWriter.GetSpooledBatchCount(); }
+    uint32_t    GetLogDBDroppedBatchCount(void) const { return mLogWriter.GetDroppedBatchCount(); }
+    uint64_t    GetLogDBSpoolLostBytes(void) const { return mLogWriter.GetSpoolLostBytes(); }
     
 public:
     
-    //  ִ ͸ Ŭ̾Ʈ鿡 ͸  Ѹ
+    // ͸   Ŭ̾Ʈ鿡 Ѹ
     void Broadcast_MONITOR_DATA_UPDATE(const BYTE serverNo, const BYTE dataType, const int32_t value, const int32_t timeStamp);
 
+    //    ð ͸   Ŭ̾Ʈ鿡 Ѹ
+    // ġ ϴ Ŭ̾ƮԴ  ŸԸ ߸ Ŷ ϳ, ׷  Ŭ̾ƮԴ Ʈ Ŷ ϳ 
+    void Broadcast_MONITOR_DATA_UPDATE_BATCH(const BYTE serverNo, const int32_t timeStamp, const MonitorPacket::DATA_UPDATE_ENTRY entries[], const uint32_t entryCount);
+
 private: // Ŷ 
 
     static Serializer* Create_CS_MONITOR_TOOL_RES_LOGIN(const BYTE status);
     static Serializer* Create_CS_MONITOR_TOOL_DATA_UPDATE(const BYTE serverNo, const BYTE dataType, const int dataValue, const int timeStamp);
+    static Serializer* Create_CS_MONITOR_TOOL_DATA_UPDATE_BATCH(const BYTE serverNo, const int timeStamp, const MonitorPacket::DATA_UPDATE_ENTRY entries[], const uint32_t entryCount);
 
 private: // Ŷ ó
 
-    // ͸ Ŭ̾Ʈ α
-    void process_CS_MONITOR_TOOL_REQ_LOGIN(const uint64_t sessionID, const char loginSessionKey[]);
+    // ͸ Ŭ̾Ʈ α (capability en_PACKET_CS_MONITOR_TOOL_CAPABILITY Ʈ )
+    void process_CS_MONITOR_TOOL_REQ_LOGIN(const uint64_t sessionID, const char loginSessionKey[], const BYTE capability);
+
+    // ͸ Ŭ̾Ʈ   (serverCount 0̸  )
+    void process_CS_MONITOR_TOOL_REQ_SUBSCRIBE(const uint64_t sessionID, const uint64_t dataTypeMask, const MonitorPacket::SUBSCRIBE_SERVER_ENTRY servers[], const uint32_t serverCount);
 
     // ٸ  ͸  α
     void process_SS_MONITOR_LOGIN(const uint64_t sessionID, const int serverNo);
@@ -82,6 +114,18 @@ private: // 
     // ٸ  ͸  
     void process_SS_MONITOR_DATA_UPDATE(const uint64_t sessionID, const BYTE dataType, const int dataValue, const int timeStamp);
 
+    // ٸ   ð ͸    
+    void process_SS_MONITOR_DATA_UPDATE_BATCH(const uint64_t sessionID, const int timeStamp, const MonitorPacket::DATA_UPDATE_ENTRY entries[], const uint32_t entryCount);
+
+    // α  ȣ ã´, α  ̶   false
+    bool findLoggedInServerNo(const uint64_t sessionID, int32_t* outServerNo);
+
+    // Ŭ̾Ʈ  ٲ  mSubscribers ԽѴ (subscription nullptr̸  )
+    void publishSubscription(const uint64_t sessionID, const MonitorSubscriberTable::Subscription* subscription);
+
+    //     ( ) ҿ  
+    void onSessionRoleReleased(const uint64_t sessionID, const MonitorSessionTable::ERole role);
+
 private: // 
 
     // ̴ ϳ  Send,Recv PDH  
@@ -93,55 +137,86 @@ private: // 
         PDH_HCOUNTER    SendBytes;
     };
 
-    // ͸  ǹ
-    struct MonitorInfo
-    {
-        int         ServerNo;
-        int         ValueSum;
-        int         Count;
-        int         Min;
-        int         Max;
-        std::mutex  Lock;
-    };
-
     // ǻ ͸  ʸ Ŭ̾Ʈ ۽ϴ  Լ
     static unsigned int machineMonitorThread(void* server);
 
-    // mLogDBWriteIntervalMinutes и DB α׸ 
+    // mLogDBWriteIntervalMinutes и   mLogWriter ѱ ( DB  mLogWriter 尡 )
     static unsigned int logDBWriteThread(void* server);
 
-    // mUnknowns  ŸӾƿ üũ
+    // α  ǵ鿡  ŸӾƿ üũ
     static unsigned int timeoutThread(void* server);
 
+    // α ͸ Ŭ̾Ʈ  ֱ ͸    (IOCP Ŀ  ʱ  и)
+    //   ǵ ư ݾ Ƿ  Ŭ̾Ʈ ٸ Ŭ̾Ʈ  ʴ´
+    static unsigned int backfillThread(void* server);
+
+    // ֱ      ġ (backfillThread )
+    // ( ȣ, ð)  ,  ð  ġ ޼ ϳ ´
+    struct BackfillCursor
+    {
+        uint64_t    SessionID;
+        int32_t     BeginTimeStamp;     //   [BeginTimeStamp, EndTimeStamp]
+        int32_t     EndTimeStamp;
+        uint32_t    ServerNo;           //   ġ
+        int32_t     TimeStamp;
+        uint32_t    SentPacketCount;
+        uint32_t    SentValueCount;
+    };
+
+    enum class EBackfillStep
+    {
+        Sent,       // ̹ ʿ °   
+        Paused,     // SendQueue  ̻  ̹ ʴ ǳʶ
+        Completed,  //  
+        Aborted,    //  ų  
+    };
+
+    // cursor ǿ   з (ִ BACKFILL_PACKETS_PER_STEP)  cursor ű
+    EBackfillStep sendBackfillStep(BackfillCursor* cursor);
+
 private:
 
-    std::map<uint64_t, uint32_t>    mUnknowns;      //  , Accept tick ( α  )
-    std::shared_mutex               mUnknownsLock;
+    //  Ű  (Unknown / Ŭ̾Ʈ /  ȣ), Ŷ ó ο     д´
+    MonitorSessionTable             mSessions;
+    TimerWheel                      mLoginTimers;           // α   ŸӾƿ (α /    )
     uint32_t                        mMaxTimeout;
     uint32_t                        mTimeoutCheckInterval;
 
-    std::list<uint64_t>             mClients;       //  ͸ Ŭ̾Ʈ
-    std::shared_mutex               mClientsLock;
+    // α ͸ Ŭ̾Ʈ  (, Ÿ)  
+    // εĳƮ   а, α//    ̺ üѴ
+    RcuPointer<MonitorSubscriberTable>  mSubscribers{ new MonitorSubscriberTable({}) };
+    std::mutex                          mSubscribersWriteLock;  // üϴ 峢 ȭ
+
+    // ͸     - ( ȣ, en_PACKET_SS_MONITOR_DATA_UPDATE Ÿ) Ѵ
+    // ͸  ڽ ӽ  MACHINE_SERVER_NO 
+    MonitorAggregator   mAggregator;
+    static constexpr uint32_t MACHINE_SERVER_NO = 10;
 
-    std::map<uint64_t, int32_t>     mServers;       // ͸  ִ 
-    std::shared_mutex               mServersLock;
+    // ֱ ͸   (Ŭ̾Ʈ ޴ serverNo )
+    MonitorHistory          mHistory;
+    MpscRingQueue<uint64_t> mBackfillRequests;  // ֱ    ID (Һڴ backfillThread)
+    static constexpr uint32_t BACKFILL_REQUEST_QUEUE_SIZE = 256;
+    static constexpr uint32_t BACKFILL_PACING_SLEEP_MS = 10;   //   Paused  ٽ Ȯϱ ð
+    static constexpr uint32_t BACKFILL_PACKETS_PER_STEP = 64;  //  ϳ  ʿ  ִ Ŷ 
 
-    // ͸    
-    // ε  en_PACKET_SS_MONITOR_DATA_UPDATE Ŷ Ÿ ǹѴ
-    MonitorInfo     mMonitorInfos[en_PACKET_SS_MONITOR_DATA_UPDATE::MAX]{};
+    // Ǹ   α (α , ŸӾƿ ) ȣ ġ ʴ ִ  (ġ ุ )
+    static constexpr uint32_t SESSION_ERROR_LOGS_PER_SECOND = 10;
 
-    DBConnector     mDBConnection;
-    uint32_t        mLogDBWriteIntervalMinutes; // DB   ()
+    DBConnector         mDBConnection;
+    MonitorLogWriter    mLogWriter{ mDBConnection };
+    uint32_t            mLogDBWriteIntervalMinutes; // DB   ()
 
     //     ̺Ʈ
     bool            mbIsRunning = false;
     HANDLE          mMachineMonitorThread;
     HANDLE          mLogDBWriteThread;
     HANDLE          mTimeoutThread;
+    HANDLE          mBackfillThread;
     HANDLE          mShutdownEvent;
     HANDLE          mMachineMonitorEvent;
     HANDLE          mLogDBWriteEvent;
     HANDLE          mTimeoutCheckEvent;
+    HANDLE          mBackfillEvent;
 
     // α  Ű
     const char*     LOGIN_SESSION_KEY = "ajfw@!cv980dSZ[fje#@fdj123948djf";
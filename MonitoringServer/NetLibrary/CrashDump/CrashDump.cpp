@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "CrashDump.h"
+#include "../Logger/Logger.h"
 
 DWORD CrashDump::s_mDumpCount;
 CrashDump CrashDump::s_mInstance;
@@ -39,6 +40,9 @@ CrashDump::CrashDump()
 
 LONG WINAPI CrashDump::myExceptionFilter(PEXCEPTION_POINTERS pExceptionPointer)
 {
+	//  ׿ִ α׸  
+	Logger::FlushOnCrash();
+
 	DWORD dumpCount = InterlockedIncrement(&s_mDumpCount);
 
 	SYSTEMTIME nowTime;
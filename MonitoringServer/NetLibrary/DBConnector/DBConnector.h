@@ -67,7 +67,7 @@ public:
     }
 
     // DB 
-    bool Connect(void)
+    virtual bool Connect(void)
     {
         if (false == mbIsConnectionInfoSet)
         {
@@ -94,45 +94,97 @@ public:
         return true;
     }
 
-    // DB  
-    void Disconnect(void) { mysql_close(mConnection); }
+    // DB   -  ٽ Connect()   ֵ MYSQL ü ʱ · ǵ
+    virtual void Disconnect(void)
+    {
+        mysql_close(mConnection);
+        mConnection = nullptr;
+
+        mysql_init(&mMySQL);
+    }
 
     //  
     bool Query(const WCHAR* formatMessage, ...)
     {
         va_list ap;
         va_start(ap, formatMessage);
+        bool retQuery = sendQuery(formatMessage, ap);
+        va_end(ap);
+
+        if (false == retQuery)
         {
-            StringCchVPrintfW(mQueryUtf16, MAX_QUERY_LENGTH, formatMessage, ap);
+            return false;
         }
+
+        mQueryResult = mysql_store_result(mConnection);
+
+        return true;
+    }
+
+    //      (INSERT, CREATE ) - mysql_store_result() ȣ ʴ´
+    bool Execute(const WCHAR* formatMessage, ...)
+    {
+        va_list ap;
+        va_start(ap, formatMessage);
+        bool retQuery = sendQuery(formatMessage, ap);
         va_end(ap);
 
-        size_t queryLength = wcslen(mQueryUtf16);
+        return retQuery;
+    }
 
-        // UTF16 -> UTF8
-        WideCharToMultiByte(CP_ACP, 0, mQueryUtf16, static_cast<int>(queryLength + 1), mQueryUtf8, sizeof(mQueryUtf8), NULL, NULL);
+    //    ƮƮ  (ϸ nullptr, GetLastError()  Ȯ)
+    //   ClosePrepared()  
+    virtual MYSQL_STMT* Prepare(const char* query)
+    {
+        MYSQL_STMT* stmt = mysql_stmt_init(mConnection);
+        if (stmt == nullptr)
+        {
+            mLastError = mysql_errno(&mMySQL);
+            return nullptr;
+        }
+
+        if (mysql_stmt_prepare(stmt, query, static_cast<unsigned long>(strlen(query))) != 0)
+        {
+            mLastError = mysql_stmt_errno(stmt);
+            mysql_stmt_close(stmt);
+            return nullptr;
+        }
+
+        return stmt;
+    }
+
+    // Ķ 迭 εϰ  ƮƮ  (   )
+    // params  Prepare()  '?'  ƾ 
+    virtual bool ExecutePrepared(MYSQL_STMT* stmt, MYSQL_BIND* params)
+    {
+        if (mysql_stmt_bind_param(stmt, params))
+        {
+            mLastError = mysql_stmt_errno(stmt);
+            return false;
+        }
 
         DWORD queryBeginTick = ::timeGetTime();
-        int retQuery = mysql_query(mConnection, mQueryUtf8);
+        int retExecute = mysql_stmt_execute(stmt);
 
         DWORD elapsed = ::timeGetTime() - queryBeginTick;
 
         if (elapsed >= 100)
         {
-            LOGF(ELogLevel::System, L"Query elapsed (%u) : %s", elapsed, mQueryUtf16);
+            LOGF(ELogLevel::System, L"Prepared statement elapsed (%u) : %u params", elapsed, mysql_stmt_param_count(stmt));
         }
 
-        if (retQuery != 0)
+        if (retExecute != 0)
         {
-            mLastError = mysql_errno(&mMySQL);
+            mLastError = mysql_stmt_errno(stmt);
             return false;
         }
 
-        mQueryResult = mysql_store_result(mConnection);
-
         return true;
     }
 
+    //  ƮƮ 
+    virtual void ClosePrepared(MYSQL_STMT* stmt) { mysql_stmt_close(stmt); }
+
     //    
     MYSQL_ROW FetchRowOrNull(void) { return mysql_fetch_row(mQueryResult); }
 
@@ -144,6 +196,38 @@ public:
         MAX_QUERY_LENGTH = 2048
     };
 
+protected:
+
+    //    
+    // Connect(), Disconnect(), sendQuery(), Prepare()   Լ̹Ƿ ؼ и ϴ ¥ Ŀ͸   ִ
+    virtual bool sendQuery(const WCHAR* formatMessage, va_list ap)
+    {
+        StringCchVPrintfW(mQueryUtf16, MAX_QUERY_LENGTH, formatMessage, ap);
+
+        size_t queryLength = wcslen(mQueryUtf16);
+
+        // UTF16 -> UTF8
+        WideCharToMultiByte(CP_ACP, 0, mQueryUtf16, static_cast<int>(queryLength + 1), mQueryUtf8, sizeof(mQueryUtf8), NULL, NULL);
+
+        DWORD queryBeginTick = ::timeGetTime();
+        int retQuery = mysql_query(mConnection, mQueryUtf8);
+
+        DWORD elapsed = ::timeGetTime() - queryBeginTick;
+
+        if (elapsed >= 100)
+        {
+            LOGF(ELogLevel::System, L"Query elapsed (%u) : %s", elapsed, mQueryUtf16);
+        }
+
+        if (retQuery != 0)
+        {
+            mLastError = mysql_errno(&mMySQL);
+            return false;
+        }
+
+        return true;
+    }
+
 private:
     MYSQL           mMySQL;
     bool            mbIsConnectionInfoSet;
@@ -156,5 +240,7 @@ private:
     MYSQL_RES*      mQueryResult = nullptr;
     WCHAR           mQueryUtf16[MAX_QUERY_LENGTH];
     char            mQueryUtf8[MAX_QUERY_LENGTH];
+
+protected:
     int             mLastError = 0;
 };
\ No newline at end of file
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <Windows.h>
+
+#include "../Logger/Logger.h"
+
+////////////////////////////////////////////////
+//  ũ 迭  MPSC(Multi-Producer Single-Consumer) ť
+//  ĭ Sequence ĭ (/ä) ǴѴ
+// Enqueue  忡 ÿ  TryDequeue  常 ȣؾ 
+//  Ҵ ,   Enqueue ϹǷ ť  Ŀ ʴ´
+////////////////////////////////////////////////
+template <typename T>
+class MpscRingQueue
+{
+public:
+    MpscRingQueue(void) = default;
+
+    ~MpscRingQueue(void)
+    {
+        delete[] mCells;
+    }
+
+    MpscRingQueue(const MpscRingQueue& other) = delete;
+    MpscRingQueue& operator=(const MpscRingQueue& other) = delete;
+
+    // ť  (capacity 2 ŵ ø)
+    void Init(const uint32_t capacity)
+    {
+        ASSERT_LIVE(mCells == nullptr, L"MpscRingQueue Init() twice");
+        ASSERT_LIVE(capacity > 0 && capacity <= 0x8000'0000, L"MpscRingQueue invalid capacity");
+
+        uint32_t realCapacity = 1;
+        while (realCapacity < capacity)
+        {
+            realCapacity <<= 1;
+        }
+
+        mCells = new Cell[realCapacity];
+        mMask = realCapacity - 1;
+
+        for (uint32_t i = 0; i < realCapacity; ++i)
+        {
+            mCells[i].Sequence = i;
+        }
+
+        mEnqueuePos = 0;
+        mDequeuePos = 0;
+    }
+
+    inline uint32_t GetCapacity(void) const { return mMask + 1; }
+
+    // ڸ   ͸   ĭ Ե 
+    inline uint32_t GetCount(void) const { return mEnqueuePos - mDequeuePos; }
+    inline bool     IsEmpty(void) const { return mEnqueuePos == mDequeuePos; }
+
+    //   ִٸ false
+    bool TryEnqueue(T data)
+    {
+        uint32_t pos = mEnqueuePos;
+        Cell* cell;
+
+        for (;;)
+        {
+            cell = &mCells[pos & mMask];
+
+            int32_t diff = static_cast<int32_t>(cell->Sequence - pos);
+
+            if (diff == 0)
+            {
+                //  ĭ - ڸ  õ
+                uint32_t prevPos = InterlockedCompareExchange(&mEnqueuePos, pos + 1, pos);
+                if (prevPos == pos)
+                {
+                    break;
+                }
+
+                pos = prevPos;
+            }
+            else if (diff < 0)
+            {
+                //    Ͱ    -  
+                return false;
+            }
+            else
+            {
+                // ٸ ڰ  
+                pos = mEnqueuePos;
+            }
+        }
+
+        cell->Data = data;
+
+        // ͸  ڿ Sequence ٲ Һڰ ϼ ͸ 
+        InterlockedExchange(&cell->Sequence, pos + 1);
+
+        return true;
+    }
+
+    //  ְų,   ĭ  ڰ  ͸  ʾҴٸ false
+    bool TryDequeue(T& outData)
+    {
+        Cell* cell = &mCells[mDequeuePos & mMask];
+
+        if (static_cast<int32_t>(cell->Sequence - (mDequeuePos + 1)) < 0)
+        {
+            return false;
+        }
+
+        outData = cell->Data;
+
+        //   ڰ   ֵ ĭ 
+        InterlockedExchange(&cell->Sequence, mDequeuePos + mMask + 1);
+
+        InterlockedIncrement(&mDequeuePos);
+
+        return true;
+    }
+
+private:
+    struct Cell
+    {
+        volatile uint32_t Sequence;
+        T Data;
+    };
+
+private:
+    alignas(64) volatile uint32_t   mEnqueuePos = 0;    // ڵ ϴ ġ
+    alignas(64) volatile uint32_t   mDequeuePos = 0;    // Һڸ ϴ ġ
+    Cell*                           mCells = nullptr;
+    uint32_t                        mMask = 0;
+};
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Windows.h>
+
+////////////////////////////////////////////////
+// бⰡ κ ü   ϱ  RCU(Read-Copy-Update) 
+// д  ReadGuard ִ  Խõ ü ״ а,    ü  Publish() ° ٲ۴
+//  ü װ а ִ    ڿ ȴ (   б īƮ Ǵ)
+// ü Խõ ڷ ϸ  Ǹ, Publish()    常 ȣؾ Ѵ
+// ReadGuard  ä Publish() ȣϸ  ٸ ȴ
+////////////////////////////////////////////////
+template <typename T>
+class RcuPointer
+{
+public:
+    class ReadGuard
+    {
+    public:
+        ~ReadGuard(void) { InterlockedDecrement(&mOwner->mReaderCounts[mEpoch].Count); }
+
+        ReadGuard(const ReadGuard& other) = delete;
+        ReadGuard& operator=(const ReadGuard& other) = delete;
+
+        inline const T* operator->(void) const { return mValue; }
+        inline const T& operator*(void) const { return *mValue; }
+
+    private:
+        friend class RcuPointer;
+
+        ReadGuard(const RcuPointer* owner) : mOwner(owner)
+        {
+            //   б  ˸
+            // īƮ ø ̿ Publish()  ٲٸ   ٽ õ
+            for (;;)
+            {
+                mEpoch = mOwner->mEpoch;
+                InterlockedIncrement(&mOwner->mReaderCounts[mEpoch].Count);
+
+                if (mEpoch == mOwner->mEpoch)
+                {
+                    break;
+                }
+
+                InterlockedDecrement(&mOwner->mReaderCounts[mEpoch].Count);
+            }
+
+            mValue = mOwner->mValue;
+        }
+
+    private:
+        const RcuPointer*   mOwner;
+        LONG                mEpoch;
+        const T*            mValue;
+    };
+
+    explicit RcuPointer(T* initialValue) : mValue(initialValue) {}
+
+    ~RcuPointer(void)
+    {
+        delete mValue;
+    }
+
+    RcuPointer(const RcuPointer& other) = delete;
+    RcuPointer& operator=(const RcuPointer& other) = delete;
+
+    // Խõ ü д´ (ReadGuard ִ   )
+    inline ReadGuard Read(void) const { return ReadGuard(this); }
+
+    //  ü Խϰ,  ü д  ⸦ ٷȴٰ Ѵ
+    void Publish(T* newValue)
+    {
+        T* oldValue = reinterpret_cast<T*>(InterlockedExchangePointer(reinterpret_cast<PVOID volatile*>(&mValue), newValue));
+
+        //  ü о  ִ     ִ -  ٲٰ      
+        LONG oldEpoch = mEpoch;
+        InterlockedExchange(&mEpoch, oldEpoch ^ 1);
+
+        while (mReaderCounts[oldEpoch].Count != 0)
+        {
+            YieldProcessor();
+        }
+
+        delete oldValue;
+    }
+
+private:
+
+    struct alignas(64) ReaderCount
+    {
+        volatile LONG   Count;
+    };
+
+private:
+
+    T* volatile                 mValue;
+    alignas(64) volatile LONG   mEpoch = 0;             //  ReadGuard  
+    mutable ReaderCount         mReaderCounts[2]{};     //  д   
+};
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstdint>
+#include <Windows.h>
+
+#include "../Logger/Logger.h"
+
+////////////////////////////////////////////////
+//   ڵ带   ũ SPSC(Single-Producer Single-Consumer)  
+// ڴ TryReserve()  ڸ ڵ带   Commit() Ѵ (  , Ҵ )
+// ڵ [ũ 8byte ][ (8byte  ø)] ̸,  ڸ ڶ  ĭ ǳʶٰ  պ 
+// ڿ Һڴ   忩 ϸ,   TryReserve() ϹǷ   Ŀ ʴ´
+////////////////////////////////////////////////
+class SpscRecordRing
+{
+public:
+    SpscRecordRing(void) = default;
+
+    ~SpscRecordRing(void)
+    {
+        delete[] mBuffer;
+    }
+
+    SpscRecordRing(const SpscRecordRing& other) = delete;
+    SpscRecordRing& operator=(const SpscRecordRing& other) = delete;
+
+    //   (capacity 2 ŵ ø)
+    void Init(const uint32_t capacity)
+    {
+        ASSERT_LIVE(mBuffer == nullptr, L"SpscRecordRing Init() twice");
+        ASSERT_LIVE(capacity >= HEADER_SIZE * 2 && capacity <= 0x8000'0000, L"SpscRecordRing invalid capacity");
+
+        uint32_t realCapacity = HEADER_SIZE;
+        while (realCapacity < capacity)
+        {
+            realCapacity <<= 1;
+        }
+
+        mBuffer = new char[realCapacity];
+        mMask = realCapacity - 1;
+        mWritePos = 0;
+        mReadPos = 0;
+    }
+
+    inline uint32_t GetCapacity(void) const { return mMask + 1; }
+
+    // Ǿ  Һ  Ʈ  (ǳʶ ĭ  )
+    inline uint32_t GetUseSize(void) const { return mWritePos - mReadPos; }
+
+    //  ڵ ִ ũ (  - )
+    inline uint32_t GetMaxRecordSize(void) const { return (GetCapacity() / 2) - HEADER_SIZE; }
+
+    // [] size Ʈ ڵ带  ڸ ´ (ڸ ٸ nullptr)
+    //  TryReserve()  Commit() ȣؾ ȴ
+    void* TryReserve(const uint32_t size)
+    {
+        if (size > GetMaxRecordSize())
+        {
+            return nullptr;
+        }
+
+        const uint32_t recordSize = HEADER_SIZE + alignUp(size);
+        const uint32_t writePos = mWritePos;
+        const uint32_t offset = writePos & mMask;
+        const uint32_t contiguousSize = GetCapacity() - offset;
+
+        //  ڸ ڶ  ĭ ǳʶڴ
+        const uint32_t skipSize = (recordSize > contiguousSize) ? contiguousSize : 0;
+
+        if (GetCapacity() - (writePos - mReadPos) < skipSize + recordSize)
+        {
+            return nullptr;
+        }
+
+        if (skipSize > 0)
+        {
+            getHeader(offset)->Size = SKIP_RECORD;
+        }
+
+        const uint32_t recordOffset = (writePos + skipSize) & mMask;
+
+        getHeader(recordOffset)->Size = size;
+        mReservedSize = skipSize + recordSize;
+
+        return mBuffer + recordOffset + HEADER_SIZE;
+    }
+
+    // []  ڵ带 Һڿ Ѵ
+    inline void Commit(void)
+    {
+        // ڵ带   ڿ ġ ٲ Һڰ ϼ ڵ带 
+        InterlockedExchange(&mWritePos, mWritePos + mReservedSize);
+        mReservedSize = 0;
+    }
+
+    // [Һ]  ڵ帶 func(const char* record, uint32_t size) ȣ, Һ ڵ  ȯ
+    // Һ ڸ Drain()     ڿ ش (ڵ帶 mReadPos  )
+    //  Drain() ߿   Ƿ,    ҺѴٸ       ũ⸦ ؾ Ѵ
+    template <typename Func>
+    uint32_t Drain(Func&& func)
+    {
+        const uint32_t writePos = mWritePos;
+        uint32_t readPos = mReadPos;
+        uint32_t recordCount = 0;
+
+        while (readPos != writePos)
+        {
+            const uint32_t offset = readPos & mMask;
+            const uint32_t size = getHeader(offset)->Size;
+
+            if (size == SKIP_RECORD)
+            {
+                readPos += GetCapacity() - offset;
+                continue;
+            }
+
+            func(mBuffer + offset + HEADER_SIZE, size);
+
+            readPos += HEADER_SIZE + alignUp(size);
+            recordCount++;
+        }
+
+        InterlockedExchange(&mReadPos, readPos);
+
+        return recordCount;
+    }
+
+private:
+
+    enum : uint32_t
+    {
+        HEADER_SIZE = 8,
+        SKIP_RECORD = 0xFFFF'FFFF  //     ǳʶ
+    };
+
+    struct RecordHeader
+    {
+        uint32_t    Size;       //  Ʈ  (ø )
+        uint32_t    Reserved;
+    };
+
+    inline RecordHeader* getHeader(const uint32_t offset) const { return reinterpret_cast<RecordHeader*>(mBuffer + offset); }
+
+    static inline uint32_t alignUp(const uint32_t size) { return (size + HEADER_SIZE - 1) & ~(HEADER_SIZE - 1); }
+
+private:
+    alignas(64) volatile uint32_t   mWritePos = 0;      // ڸ ϴ ġ
+    uint32_t                        mReservedSize = 0;  //     ũ ( )
+    alignas(64) volatile uint32_t   mReadPos = 0;       // Һڸ ϴ ġ
+    char*                           mBuffer = nullptr;
+    uint32_t                        mMask = 0;
+};
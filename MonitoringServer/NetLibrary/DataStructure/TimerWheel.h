@@ -0,0 +1,302 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Windows.h>
+
+#include "../Logger/Logger.h"
+
+////////////////////////////////////////////////
+//  ID Ű ϴ  Ÿ̸  (64ĭ * 4ܰ,  ĭ tickMs)
+// Ÿ̸Ӵ  Ű( ID  32Ʈ) ϳ̸, 尡  Ű ε̵ 迭 ̸  ־ Ҵ 
+// Schedule / Cancel O(1) (ĭ Ʈ 带 ̰ų ⸸ ),  ˻ Advance()  ĭ 
+//  ̷ Ÿ̸Ӵ  ܰ迡 ξٰ Ʒ ܰ谡      ܰ辿 ´
+//
+//  Ű ǹǷ  Ű   ID Scheduleϸ   Ÿ̸Ӵ ,
+// ٸ   ID Cancelϸ ƹ͵  ʴ´
+//  ݹ  ۿ ȣǹǷ      ִ - ݹ鿡  ID ȿ Ȯؾ 
+////////////////////////////////////////////////
+class TimerWheel
+{
+public:
+    TimerWheel(void) = default;
+
+    ~TimerWheel(void)
+    {
+        delete[] mNodes;
+    }
+
+    TimerWheel(const TimerWheel& other) = delete;
+    TimerWheel& operator=(const TimerWheel& other) = delete;
+
+    //  Ű ŭ 带  (̶  Ÿ̸ӵ )
+    void Init(const uint32_t maxSessionCount, const uint32_t tickMs)
+    {
+        ASSERT_LIVE(tickMs > 0, L"TimerWheel tickMs can not be zero");
+
+        delete[] mNodes;
+
+        mNodes = new Node[maxSessionCount];
+        mNodeCount = maxSessionCount;
+
+        for (uint32_t i = 0; i < maxSessionCount; ++i)
+        {
+            mNodes[i].SessionID = 0;
+            mNodes[i].Slot = INVALID_SLOT;
+        }
+
+        for (uint32_t& head : mHeads)
+        {
+            head = INVALID_INDEX;
+        }
+
+        mTickMs = tickMs;
+        mStartTick = ::GetTickCount64();
+        mCurrentTick = 0;
+        mTimerCount = 0;
+    }
+
+    inline uint32_t GetTickMs(void) const { return mTickMs; }
+    inline uint32_t GetTimerCount(void) const { return mTimerCount; }
+
+    // delayMs ڿ ǵ Ѵ (  Ű ɷִ Ÿ̸Ӵ   ٲ)
+    //  tickMs  øǸ,  (tickMs * 64^4) Ѵ ð   δ
+    void Schedule(const uint64_t sessionID, const uint32_t delayMs)
+    {
+        const uint32_t index = getIndex(sessionID);
+
+        ::AcquireSRWLockExclusive(&mLock);
+
+        schedule(index, sessionID, delayMs);
+
+        ::ReleaseSRWLockExclusive(&mLock);
+    }
+
+    //    Ű Schedule  sessionID  ٽ Ǵ ( ݹ鿡  ðŭ   )
+    // ݹ θ      Ű Scheduleߴٸ  Ÿ̸Ӹ  ʰ false
+    bool Reschedule(const uint64_t sessionID, const uint32_t delayMs)
+    {
+        const uint32_t index = getIndex(sessionID);
+
+        ::AcquireSRWLockExclusive(&mLock);
+
+        const bool bIsOwner = (mNodes[index].SessionID == sessionID);
+
+        if (bIsOwner)
+        {
+            schedule(index, sessionID, delayMs);
+        }
+
+        ::ReleaseSRWLockExclusive(&mLock);
+
+        return bIsOwner;
+    }
+
+    // ɷִ Ÿ̸Ӹ Ѵ (̹ Ǿų ٸ   ID ƹ͵  )
+    void Cancel(const uint64_t sessionID)
+    {
+        const uint32_t index = getIndex(sessionID);
+
+        ::AcquireSRWLockExclusive(&mLock);
+
+        const Node& node = mNodes[index];
+
+        if (node.Slot != INVALID_SLOT && node.SessionID == sessionID)
+        {
+            unlink(index);
+        }
+
+        ::ReleaseSRWLockExclusive(&mLock);
+    }
+
+    // ݱ  ĭ óϰ,  Ǹ func(sessionID) ȣ ( 忡 ȣؾ )
+    // ݹ ȿ Schedule / Reschedule / Cancel ȣص ȴ
+    template <typename Func>
+    void Advance(Func&& func)
+    {
+        ::AcquireSRWLockExclusive(&mLock);
+
+        const uint64_t targetTick = (::GetTickCount64() - mStartTick) / mTickMs;
+
+        while (mCurrentTick < targetTick)
+        {
+            mCurrentTick++;
+
+            // Ʒ ܰ谡   Ҵٸ  ܰ ش ĭ ٽ ġѴ
+            for (uint32_t level = 1; level < LEVEL_COUNT; ++level)
+            {
+                if (getSlotInLevel(mCurrentTick, level - 1) != 0)
+                {
+                    break;
+                }
+
+                cascade(level * SLOT_COUNT + getSlotInLevel(mCurrentTick, level));
+            }
+
+            // 0ܰ  ĭ ִ Ÿ̸Ӵ  
+            const uint32_t slot = getSlotInLevel(mCurrentTick, 0);
+
+            while (mHeads[slot] != INVALID_INDEX)
+            {
+                const uint32_t index = mHeads[slot];
+
+                mExpired.push_back(mNodes[index].SessionID);
+                unlink(index);
+            }
+        }
+
+        ::ReleaseSRWLockExclusive(&mLock);
+
+        for (const uint64_t sessionID : mExpired)
+        {
+            func(sessionID);
+        }
+
+        mExpired.clear();
+    }
+
+private:
+
+    enum : uint32_t
+    {
+        SLOT_BITS = 6,
+        SLOT_COUNT = 1 << SLOT_BITS,
+        SLOT_MASK = SLOT_COUNT - 1,
+        LEVEL_COUNT = 4,
+        INVALID_INDEX = 0xFFFF'FFFF
+    };
+
+    static constexpr uint16_t INVALID_SLOT = 0xFFFF;
+    static constexpr uint64_t MAX_DELAY_TICK = (1ull << (SLOT_BITS * LEVEL_COUNT)) - 1;
+
+    struct Node
+    {
+        uint64_t    SessionID;
+        uint64_t    ExpireTick;
+        uint32_t    Prev;
+        uint32_t    Next;
+        uint16_t    Slot;   // mHeads ε (INVALID_SLOT̸ ɷ )
+    };
+
+    inline uint32_t getIndex(const uint64_t sessionID) const
+    {
+        const uint32_t index = static_cast<uint32_t>(sessionID >> 32);
+
+        ASSERT_LIVE(index < mNodeCount, L"TimerWheel invalid session key");
+
+        return index;
+    }
+
+    static inline uint32_t getSlotInLevel(const uint64_t tick, const uint32_t level) { return static_cast<uint32_t>(tick >> (SLOT_BITS * level)) & SLOT_MASK; }
+
+    void schedule(const uint32_t index, const uint64_t sessionID, const uint32_t delayMs)
+    {
+        Node& node = mNodes[index];
+
+        if (node.Slot != INVALID_SLOT)
+        {
+            unlink(index);
+        }
+
+        const uint64_t elapsedMs = ::GetTickCount64() - mStartTick;
+        uint64_t expireTick = (elapsedMs + delayMs + mTickMs - 1) / mTickMs;
+
+        if (expireTick <= mCurrentTick)
+        {
+            expireTick = mCurrentTick + 1;
+        }
+
+        node.SessionID = sessionID;
+        node.ExpireTick = expireTick;
+
+        place(index);
+    }
+
+    //  ð ´ ܰ ĭ 带 δ
+    void place(const uint32_t index)
+    {
+        Node& node = mNodes[index];
+
+        uint64_t delayTick = (node.ExpireTick > mCurrentTick) ? node.ExpireTick - mCurrentTick : 0;
+
+        if (delayTick > MAX_DELAY_TICK)
+        {
+            delayTick = MAX_DELAY_TICK;
+            node.ExpireTick = mCurrentTick + MAX_DELAY_TICK;
+        }
+
+        uint32_t level = 0;
+        while (level < LEVEL_COUNT - 1 && delayTick >= (1ull << (SLOT_BITS * (level + 1))))
+        {
+            level++;
+        }
+
+        // ̹  Ÿ̸( ܰ迡  )  ĭ ٿ ̹ ƽ Ų
+        const uint64_t tick = (delayTick == 0) ? mCurrentTick : node.ExpireTick;
+        const uint32_t slot = level * SLOT_COUNT + getSlotInLevel(tick, level);
+
+        node.Slot = static_cast<uint16_t>(slot);
+        node.Prev = INVALID_INDEX;
+        node.Next = mHeads[slot];
+
+        if (node.Next != INVALID_INDEX)
+        {
+            mNodes[node.Next].Prev = index;
+        }
+
+        mHeads[slot] = index;
+        mTimerCount++;
+    }
+
+    void unlink(const uint32_t index)
+    {
+        Node& node = mNodes[index];
+
+        if (node.Prev != INVALID_INDEX)
+        {
+            mNodes[node.Prev].Next = node.Next;
+        }
+        else
+        {
+            mHeads[node.Slot] = node.Next;
+        }
+
+        if (node.Next != INVALID_INDEX)
+        {
+            mNodes[node.Next].Prev = node.Prev;
+        }
+
+        node.Slot = INVALID_SLOT;
+        mTimerCount--;
+    }
+
+    // ĭ    ð ° ٽ ġѴ
+    void cascade(const uint32_t slot)
+    {
+        uint32_t index = mHeads[slot];
+
+        mHeads[slot] = INVALID_INDEX;
+
+        while (index != INVALID_INDEX)
+        {
+            const uint32_t next = mNodes[index].Next;
+
+            mTimerCount--;
+            place(index);
+
+            index = next;
+        }
+    }
+
+private:
+
+    SRWLOCK                 mLock = SRWLOCK_INIT;
+    Node*                   mNodes = nullptr;                   // [ Ű]
+    uint32_t                mNodeCount = 0;
+    uint32_t                mHeads[SLOT_COUNT * LEVEL_COUNT];   // [ܰ * SLOT_COUNT + ĭ]  Ʈ ù 
+    uint32_t                mTickMs = 0;
+    uint32_t                mTimerCount = 0;                    // ɷִ Ÿ̸ 
+    uint64_t                mStartTick = 0;                     // Init()  GetTickCount64()
+    uint64_t                mCurrentTick = 0;                   // ó   ƽ
+    std::vector<uint64_t>   mExpired;                           // Advance() ݹ θ  ID ()
+};
@@ -0,0 +1,221 @@
+#pragma once
+
+#pragma comment(lib, "cabinet.lib")
+
+#include <cstdint>
+#include <vector>
+#include <Windows.h>
+#include <compressapi.h>
+
+////////////////////////////////////////////////
+// Ʈ α   /  (ΰ   LogDecoder  )
+//  CHUNK_SIZE Windows Compression API(XPRESS_HUFF)  ϹǷ  Ŀ ޸𸮴 ûũ ũ⸸ŭ 
+//   : [FileHeader][ChunkHeader][ ûũ]...
+////////////////////////////////////////////////
+class LogArchive final
+{
+public:
+    //   Ȯ ( ϸ ڿ ٴ´)
+    static constexpr const WCHAR* EXTENSION = L".xpress";
+
+    // srcFileName ؼ dstFileName  (ϸ  dstFileName  false)
+    static bool CompressFile(const WCHAR* srcFileName, const WCHAR* dstFileName)
+    {
+        COMPRESSOR_HANDLE compressor;
+
+        if (FALSE == ::CreateCompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &compressor))
+        {
+            return false;
+        }
+
+        Files files;
+        bool bSucceeded = files.Open(srcFileName, dstFileName);
+
+        if (bSucceeded)
+        {
+            const FileHeader fileHeader = { MAGIC, VERSION };
+            bSucceeded = writeAll(files.hDst, &fileHeader, sizeof(fileHeader));
+        }
+
+        std::vector<char> raw(CHUNK_SIZE);
+        std::vector<char> compressed(CHUNK_SIZE + CHUNK_SIZE / 8);
+
+        while (bSucceeded)
+        {
+            DWORD rawSize;
+
+            if (FALSE == ::ReadFile(files.hSrc, raw.data(), CHUNK_SIZE, &rawSize, nullptr))
+            {
+                bSucceeded = false;
+                break;
+            }
+
+            if (rawSize == 0)
+            {
+                break;
+            }
+
+            SIZE_T compressedSize;
+
+            if (FALSE == ::Compress(compressor, raw.data(), rawSize, compressed.data(), compressed.size(), &compressedSize))
+            {
+                //   Ǵ Ͷ   Ŀٸ ʿ ũ ÷ ٽ
+                if (::GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+                {
+                    bSucceeded = false;
+                    break;
+                }
+
+                compressed.resize(compressedSize);
+
+                if (FALSE == ::Compress(compressor, raw.data(), rawSize, compressed.data(), compressed.size(), &compressedSize))
+                {
+                    bSucceeded = false;
+                    break;
+                }
+            }
+
+            const ChunkHeader chunkHeader = { rawSize, static_cast<uint32_t>(compressedSize) };
+            bSucceeded = writeAll(files.hDst, &chunkHeader, sizeof(chunkHeader)) && writeAll(files.hDst, compressed.data(), chunkHeader.CompressedSize);
+        }
+
+        ::CloseCompressor(compressor);
+        files.Close(bSucceeded, dstFileName);
+
+        return bSucceeded;
+    }
+
+    // CompressFile  srcFileName Ǯ dstFileName  (ϸ  dstFileName  false)
+    static bool DecompressFile(const WCHAR* srcFileName, const WCHAR* dstFileName)
+    {
+        DECOMPRESSOR_HANDLE decompressor;
+
+        if (FALSE == ::CreateDecompressor(COMPRESS_ALGORITHM_XPRESS_HUFF, nullptr, &decompressor))
+        {
+            return false;
+        }
+
+        Files files;
+        bool bSucceeded = files.Open(srcFileName, dstFileName);
+
+        if (bSucceeded)
+        {
+            FileHeader fileHeader;
+            bSucceeded = readAll(files.hSrc, &fileHeader, sizeof(fileHeader)) && fileHeader.Magic == MAGIC && fileHeader.Version == VERSION;
+        }
+
+        std::vector<char> raw(CHUNK_SIZE);
+        std::vector<char> compressed;
+
+        while (bSucceeded)
+        {
+            ChunkHeader chunkHeader;
+            DWORD readSize;
+
+            if (FALSE == ::ReadFile(files.hSrc, &chunkHeader, sizeof(chunkHeader), &readSize, nullptr) || (readSize != 0 && readSize != sizeof(chunkHeader)))
+            {
+                bSucceeded = false;
+                break;
+            }
+
+            if (readSize == 0)
+            {
+                break;
+            }
+
+            if (chunkHeader.RawSize > CHUNK_SIZE)
+            {
+                bSucceeded = false;
+                break;
+            }
+
+            compressed.resize(chunkHeader.CompressedSize);
+
+            SIZE_T rawSize;
+
+            bSucceeded = readAll(files.hSrc, compressed.data(), chunkHeader.CompressedSize)
+                && ::Decompress(decompressor, compressed.data(), chunkHeader.CompressedSize, raw.data(), chunkHeader.RawSize, &rawSize)
+                && rawSize == chunkHeader.RawSize
+                && writeAll(files.hDst, raw.data(), chunkHeader.RawSize);
+        }
+
+        ::CloseDecompressor(decompressor);
+        files.Close(bSucceeded, dstFileName);
+
+        return bSucceeded;
+    }
+
+private:
+
+    enum : uint32_t
+    {
+        MAGIC = 0x4352414C,         // "LARC"
+        VERSION = 1,
+        CHUNK_SIZE = 1024 * 1024,
+    };
+
+    struct FileHeader
+    {
+        uint32_t    Magic;
+        uint32_t    Version;
+    };
+
+    struct ChunkHeader
+    {
+        uint32_t    RawSize;
+        uint32_t    CompressedSize;
+    };
+
+    //  /   ڵ (  ϸ )
+    struct Files
+    {
+        HANDLE  hSrc = INVALID_HANDLE_VALUE;
+        HANDLE  hDst = INVALID_HANDLE_VALUE;
+
+        bool Open(const WCHAR* srcFileName, const WCHAR* dstFileName)
+        {
+            hSrc = ::CreateFileW(srcFileName, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+            if (hSrc == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+
+            hDst = ::CreateFileW(dstFileName, GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+            return hDst != INVALID_HANDLE_VALUE;
+        }
+
+        void Close(const bool bSucceeded, const WCHAR* dstFileName)
+        {
+            if (hSrc != INVALID_HANDLE_VALUE)
+            {
+                ::CloseHandle(hSrc);
+            }
+
+            if (hDst != INVALID_HANDLE_VALUE)
+            {
+                ::CloseHandle(hDst);
+
+                if (false == bSucceeded)
+                {
+                    ::DeleteFileW(dstFileName);
+                }
+            }
+        }
+    };
+
+    static bool writeAll(HANDLE hFile, const void* data, const uint32_t size)
+    {
+        DWORD writtenSize;
+
+        return ::WriteFile(hFile, data, size, &writtenSize, nullptr) && writtenSize == size;
+    }
+
+    static bool readAll(HANDLE hFile, void* outData, const uint32_t size)
+    {
+        DWORD readSize;
+
+        return ::ReadFile(hFile, outData, size, &readSize, nullptr) && readSize == size;
+    }
+};
@@ -0,0 +1,561 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <cwchar>
+#include <type_traits>
+
+typedef wchar_t WCHAR;
+
+// LOGF   (.blog Ͽ ״ ϵǹǷ  ٲٸ  )
+enum class ELogArgKind : uint8_t
+{
+    Invalid = 0,    // LOGF    Ÿ
+    Int32,          // 4byte   (bool, enum )
+    UInt32,
+    Int64,
+    UInt64,
+    Double,
+    String,         // const WCHAR*
+    Pointer,
+};
+
+// Ÿ -> ELogArgKind
+template <typename T, typename Enable = void>
+struct LogArgKindOf
+{
+    static constexpr ELogArgKind Value = ELogArgKind::Invalid;
+};
+
+template <typename T>
+struct LogArgKindOf<T, std::enable_if_t<std::is_integral<T>::value>>
+{
+    static constexpr ELogArgKind Value = (sizeof(T) <= 4)
+        ? (std::is_signed<T>::value ? ELogArgKind::Int32 : ELogArgKind::UInt32)
+        : (std::is_signed<T>::value ? ELogArgKind::Int64 : ELogArgKind::UInt64);
+};
+
+template <typename T>
+struct LogArgKindOf<T, std::enable_if_t<std::is_enum<T>::value>>
+{
+    static constexpr ELogArgKind Value = LogArgKindOf<std::underlying_type_t<T>>::Value;
+};
+
+template <typename T>
+struct LogArgKindOf<T, std::enable_if_t<std::is_floating_point<T>::value>>
+{
+    static constexpr ELogArgKind Value = ELogArgKind::Double;
+};
+
+template <typename T>
+struct LogArgKindOf<T, std::enable_if_t<std::is_pointer<T>::value>>
+{
+    static constexpr ELogArgKind Value = std::is_same<std::remove_cv_t<std::remove_pointer_t<T>>, WCHAR>::value ? ELogArgKind::String : ELogArgKind::Pointer;
+};
+
+// LOGF ȣ ġ   ( Invalid ϳ  ξ ڰ  迭  ʰ )
+template <typename... Ts>
+struct LogArgKinds
+{
+    static constexpr uint32_t Count = sizeof...(Ts);
+    static constexpr ELogArgKind Kinds[sizeof...(Ts) + 1] = { LogArgKindOf<Ts>::Value..., ELogArgKind::Invalid };
+};
+
+template <typename... Ts>
+constexpr ELogArgKind LogArgKinds<Ts...>::Kinds[sizeof...(Ts) + 1];
+
+// decltype(LogArgKindsOf(args...)) ڵ LogArgKinds ´ ( , 򰡵 ʴ  )
+template <typename... Ts>
+LogArgKinds<std::decay_t<Ts>...> LogArgKindsOf(Ts...);
+
+////////////////////////////////////////////////
+// LOGF ̳ʸ α  ˻ /  ڵ / ڿ ȯ (ΰſ LogDecoder  )
+// αϴ  ڸ  ״ 縸 ϰ,  ڿ ȣ ġ  (LogSite) ´
+// ڿ   α 峪 LogDecoder FormatLine() Ѵ
+//  ڵ : 32bit  4byte, 64bit  / Ǽ /  8byte, ڿ [ 2byte][ڵ (  )]
+////////////////////////////////////////////////
+class LogFormatter final
+{
+public:
+    enum : uint32_t
+    {
+        MAX_ARGS_SIZE = 1024,           //  α ڵ  ִ ũ (ġ ڴ )
+        MAX_STRING_ARG_LENGTH = 255,    // ڿ  ִ  (ġ ߸)
+        TIME_INFO_LENGTH = 16,          // YYYYMMDD_hhmmss +  
+    };
+
+    //  ڿ ȯ ڵ   ´  ð ˻Ѵ
+    //  ũ⸸  ȣ   (%d DWORD ), * ʺ / е %n  ʴ´
+    template <typename ArgKinds, size_t N>
+    static constexpr bool IsValidFormat(const WCHAR(&format)[N])
+    {
+        return isValidFormat(format, ArgKinds::Kinds, ArgKinds::Count);
+    }
+
+    // [αϴ ]  ϳ buffer[offset] ϰ  ġ ȯѴ (ڸ ڶ  )
+    template <typename T>
+    static inline uint32_t EncodeArg(char* buffer, const uint32_t offset, const T& arg)
+    {
+        return encodeArg(buffer, offset, arg, ArgKindTag<LogArgKindOf<std::decay_t<T>>::Value>());
+    }
+
+    // FILETIME(100ns ) -> YYYYMMDD_hhmmss ( ð)
+    static void GetTimeInfo(const uint64_t fileTime, WCHAR* outBuffer)
+    {
+        constexpr uint64_t UNIX_EPOCH_FILETIME = 116444736000000000ull;
+
+        const time_t unixTime = static_cast<time_t>((fileTime - UNIX_EPOCH_FILETIME) / 10000000ull);
+        tm localTime;
+        localtime_s(&localTime, &unixTime);
+
+        swprintf(outBuffer, TIME_INFO_LENGTH, L"%04d%02d%02d_%02d%02d%02d",
+            localTime.tm_year + 1900, localTime.tm_mon + 1, localTime.tm_mday, localTime.tm_hour, localTime.tm_min, localTime.tm_sec);
+    }
+
+    // "[timeInfo] : ޼\n"    (  ) ȯѴ (LOGF  ؽƮ α׿  , ġ ߸)
+    // ڰ ְų (args ڶ) ڰ     (.blog     )  ڸ <broken>  
+    static uint32_t FormatLine(WCHAR* out, const uint32_t outLength, const WCHAR* timeInfo, const WCHAR* format,
+        const ELogArgKind* kinds, const uint32_t argCount, const char* args, const uint32_t argsSize)
+    {
+        // '\n'   ڸ ܵд
+        const uint32_t messageEnd = outLength - 2;
+
+        int written = swprintf(out, messageEnd, L"[%s] : ", timeInfo);
+        uint32_t length = (written > 0) ? static_cast<uint32_t>(written) : 0;
+
+        uint32_t argIndex = 0;
+        uint32_t argsOffset = 0;
+        const WCHAR* p = format;
+
+        while (*p != L'\0' && length < messageEnd - 1)
+        {
+            if (*p != L'%')
+            {
+                out[length++] = *p++;
+                continue;
+            }
+
+            if (p[1] == L'%')
+            {
+                out[length++] = L'%';
+                p += 2;
+                continue;
+            }
+
+            const FormatSpec spec = parseSpec(p);
+
+            if (spec.Conversion == L'\0' || argIndex >= argCount || false == isMatched(spec, kinds[argIndex])
+                || false == appendArg(out, messageEnd, &length, spec, kinds[argIndex], args, argsSize, &argsOffset))
+            {
+                written = swprintf(out + length, messageEnd - length, L"<broken>");
+                length += (written > 0) ? static_cast<uint32_t>(written) : 0;
+                break;
+            }
+
+            argIndex++;
+            p = spec.End;
+        }
+
+        out[length++] = L'\n';
+        out[length] = L'\0';
+
+        return length;
+    }
+
+private:
+
+    enum class ELengthModifier : uint8_t
+    {
+        None,
+        Short,      // h, hh
+        Long,       // l (Windows 32bit)
+        LongLong,   // ll, I64
+        Int32,      // I32
+        Size,       // z, I
+        LongDouble, // L
+    };
+
+    // %  ȯ ڱ
+    struct FormatSpec
+    {
+        const WCHAR*    Begin;
+        const WCHAR*    End;            // ȯ  
+        WCHAR           Conversion;     //  ڶ L'\0'
+        ELengthModifier Length;
+    };
+
+    template <ELogArgKind Kind>
+    using ArgKindTag = std::integral_constant<ELogArgKind, Kind>;
+
+    static constexpr bool isDigit(const WCHAR c) { return c >= L'0' && c <= L'9'; }
+
+    static constexpr FormatSpec parseSpec(const WCHAR* begin)
+    {
+        FormatSpec spec = { begin, begin, L'\0', ELengthModifier::None };
+        const WCHAR* p = begin + 1;
+
+        while (*p == L'-' || *p == L'+' || *p == L' ' || *p == L'#' || *p == L'0')
+        {
+            ++p;
+        }
+
+        if (*p == L'*')
+        {
+            return spec;
+        }
+
+        while (isDigit(*p))
+        {
+            ++p;
+        }
+
+        if (*p == L'.')
+        {
+            ++p;
+
+            if (*p == L'*')
+            {
+                return spec;
+            }
+
+            while (isDigit(*p))
+            {
+                ++p;
+            }
+        }
+
+        if (p[0] == L'h')
+        {
+            spec.Length = ELengthModifier::Short;
+            p += (p[1] == L'h') ? 2 : 1;
+        }
+        else if (p[0] == L'l')
+        {
+            spec.Length = (p[1] == L'l') ? ELengthModifier::LongLong : ELengthModifier::Long;
+            p += (p[1] == L'l') ? 2 : 1;
+        }
+        else if (p[0] == L'I' && p[1] == L'6' && p[2] == L'4')
+        {
+            spec.Length = ELengthModifier::LongLong;
+            p += 3;
+        }
+        else if (p[0] == L'I' && p[1] == L'3' && p[2] == L'2')
+        {
+            spec.Length = ELengthModifier::Int32;
+            p += 3;
+        }
+        else if (p[0] == L'z' || p[0] == L'I')
+        {
+            spec.Length = ELengthModifier::Size;
+            p += 1;
+        }
+        else if (p[0] == L'L')
+        {
+            spec.Length = ELengthModifier::LongDouble;
+            p += 1;
+        }
+
+        if (*p == L'\0')
+        {
+            return spec;
+        }
+
+        spec.Conversion = *p;
+        spec.End = p + 1;
+
+        return spec;
+    }
+
+    static constexpr bool isIntegerMatched(const ELengthModifier length, const ELogArgKind kind)
+    {
+        const bool bIs32 = (kind == ELogArgKind::Int32 || kind == ELogArgKind::UInt32);
+        const bool bIs64 = (kind == ELogArgKind::Int64 || kind == ELogArgKind::UInt64);
+
+        switch (length)
+        {
+        case ELengthModifier::None:
+        case ELengthModifier::Short:
+        case ELengthModifier::Long:
+        case ELengthModifier::Int32:
+            return bIs32;
+        case ELengthModifier::LongLong:
+            return bIs64;
+        case ELengthModifier::Size:
+            return (sizeof(size_t) == 8) ? bIs64 : bIs32;
+        default:
+            return false;
+        }
+    }
+
+    static constexpr bool isMatched(const FormatSpec& spec, const ELogArgKind kind)
+    {
+        switch (spec.Conversion)
+        {
+        case L'd': case L'i': case L'o': case L'u': case L'x': case L'X': case L'c':
+            return isIntegerMatched(spec.Length, kind);
+        case L's':
+            return (spec.Length == ELengthModifier::None || spec.Length == ELengthModifier::Long) && kind == ELogArgKind::String;
+        case L'f': case L'F': case L'e': case L'E': case L'g': case L'G': case L'a': case L'A':
+            return (spec.Length == ELengthModifier::None || spec.Length == ELengthModifier::Long || spec.Length == ELengthModifier::LongDouble) && kind == ELogArgKind::Double;
+        case L'p':
+            return spec.Length == ELengthModifier::None && kind == ELogArgKind::Pointer;
+        default:
+            return false;
+        }
+    }
+
+    static constexpr bool isValidFormat(const WCHAR* format, const ELogArgKind* kinds, const uint32_t argCount)
+    {
+        uint32_t argIndex = 0;
+        const WCHAR* p = format;
+
+        while (*p != L'\0')
+        {
+            if (*p != L'%')
+            {
+                ++p;
+                continue;
+            }
+
+            if (p[1] == L'%')
+            {
+                p += 2;
+                continue;
+            }
+
+            const FormatSpec spec = parseSpec(p);
+
+            if (spec.Conversion == L'\0' || argIndex >= argCount || false == isMatched(spec, kinds[argIndex]))
+            {
+                return false;
+            }
+
+            argIndex++;
+            p = spec.End;
+        }
+
+        return argIndex == argCount;
+    }
+
+    template <typename Value>
+    static inline uint32_t encodeValue(char* buffer, const uint32_t offset, const Value value)
+    {
+        if (offset + sizeof(Value) > MAX_ARGS_SIZE)
+        {
+            return offset;
+        }
+
+        memcpy(buffer + offset, &value, sizeof(Value));
+
+        return offset + sizeof(Value);
+    }
+
+    template <typename T>
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const T& arg, ArgKindTag<ELogArgKind::Int32>) { return encodeValue(buffer, offset, static_cast<int32_t>(arg)); }
+
+    template <typename T>
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const T& arg, ArgKindTag<ELogArgKind::UInt32>) { return encodeValue(buffer, offset, static_cast<uint32_t>(arg)); }
+
+    template <typename T>
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const T& arg, ArgKindTag<ELogArgKind::Int64>) { return encodeValue(buffer, offset, static_cast<int64_t>(arg)); }
+
+    template <typename T>
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const T& arg, ArgKindTag<ELogArgKind::UInt64>) { return encodeValue(buffer, offset, static_cast<uint64_t>(arg)); }
+
+    template <typename T>
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const T& arg, ArgKindTag<ELogArgKind::Double>) { return encodeValue(buffer, offset, static_cast<double>(arg)); }
+
+    template <typename T>
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const T& arg, ArgKindTag<ELogArgKind::Pointer>) { return encodeValue(buffer, offset, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(arg))); }
+
+    static inline uint32_t encodeArg(char* buffer, const uint32_t offset, const WCHAR* arg, ArgKindTag<ELogArgKind::String>)
+    {
+        if (offset + sizeof(uint16_t) > MAX_ARGS_SIZE)
+        {
+            return offset;
+        }
+
+        if (arg == nullptr)
+        {
+            arg = L"(null)";
+        }
+
+        const uint32_t maxLength = (MAX_ARGS_SIZE - offset - sizeof(uint16_t)) / sizeof(WCHAR);
+        uint32_t length = 0;
+
+        while (arg[length] != L'\0' && length < MAX_STRING_ARG_LENGTH && length < maxLength)
+        {
+            length++;
+        }
+
+        const uint16_t encodedLength = static_cast<uint16_t>(length);
+        memcpy(buffer + offset, &encodedLength, sizeof(encodedLength));
+        memcpy(buffer + offset + sizeof(encodedLength), arg, length * sizeof(WCHAR));
+
+        return offset + sizeof(encodedLength) + length * sizeof(WCHAR);
+    }
+
+    template <typename Value>
+    static inline bool decodeValue(const char* args, const uint32_t argsSize, uint32_t* inOutOffset, Value* outValue)
+    {
+        if (*inOutOffset + sizeof(Value) > argsSize)
+        {
+            return false;
+        }
+
+        memcpy(outValue, args + *inOutOffset, sizeof(Value));
+        *inOutOffset += sizeof(Value);
+
+        return true;
+    }
+
+    template <typename Value>
+    static inline int printArg(WCHAR* out, const uint32_t outLength, const WCHAR* spec, const char* args, const uint32_t argsSize, uint32_t* inOutOffset)
+    {
+        Value value;
+
+        if (false == decodeValue(args, argsSize, inOutOffset, &value))
+        {
+            return -2;
+        }
+
+        return swprintf(out, outLength, spec, value);
+    }
+
+    //  ϳ spec out[*inOutLength] ̾  (ڰ ִٸ false)
+    static bool appendArg(WCHAR* out, const uint32_t outLength, uint32_t* inOutLength, const FormatSpec& spec, const ELogArgKind kind,
+        const char* args, const uint32_t argsSize, uint32_t* inOutArgsOffset)
+    {
+        WCHAR specBuffer[16];
+        const size_t specLength = spec.End - spec.Begin;
+
+        if (specLength >= sizeof(specBuffer) / sizeof(WCHAR))
+        {
+            return false;
+        }
+
+        wmemcpy(specBuffer, spec.Begin, specLength);
+        specBuffer[specLength] = L'\0';
+
+        WCHAR* dest = out + *inOutLength;
+        const uint32_t destLength = outLength - *inOutLength;
+        int written;
+
+        switch (kind)
+        {
+        case ELogArgKind::Int32:
+            written = printArg<int32_t>(dest, destLength, specBuffer, args, argsSize, inOutArgsOffset);
+            break;
+        case ELogArgKind::UInt32:
+            written = printArg<uint32_t>(dest, destLength, specBuffer, args, argsSize, inOutArgsOffset);
+            break;
+        case ELogArgKind::Int64:
+            written = printArg<long long>(dest, destLength, specBuffer, args, argsSize, inOutArgsOffset);
+            break;
+        case ELogArgKind::UInt64:
+            written = printArg<unsigned long long>(dest, destLength, specBuffer, args, argsSize, inOutArgsOffset);
+            break;
+        case ELogArgKind::Double:
+            written = printArg<double>(dest, destLength, specBuffer, args, argsSize, inOutArgsOffset);
+            break;
+        case ELogArgKind::Pointer:
+        {
+            uint64_t value;
+
+            if (false == decodeValue(args, argsSize, inOutArgsOffset, &value))
+            {
+                return false;
+            }
+
+            written = swprintf(dest, destLength, specBuffer, reinterpret_cast<void*>(static_cast<uintptr_t>(value)));
+            break;
+        }
+        case ELogArgKind::String:
+        {
+            uint16_t length;
+
+            if (false == decodeValue(args, argsSize, inOutArgsOffset, &length) || length > MAX_STRING_ARG_LENGTH || *inOutArgsOffset + length * sizeof(WCHAR) > argsSize)
+            {
+                return false;
+            }
+
+            WCHAR value[MAX_STRING_ARG_LENGTH + 1];
+            memcpy(value, args + *inOutArgsOffset, length * sizeof(WCHAR));
+            value[length] = L'\0';
+            *inOutArgsOffset += length * sizeof(WCHAR);
+
+            written = swprintf(dest, destLength, specBuffer, value);
+            break;
+        }
+        default:
+            return false;
+        }
+
+        if (written == -2)
+        {
+            return false;
+        }
+
+        // ƴٸ ߸ ä д
+        if (written < 0)
+        {
+            dest[destLength - 1] = L'\0';
+            written = static_cast<int>(wcslen(dest));
+        }
+
+        *inOutLength += static_cast<uint32_t>(written);
+
+        return true;
+    }
+};
+
+////////////////////////////////////////////////
+// ̳ʸ α (.blog)  - [FileHeader][ڵ]...
+// ڵ [RecordHeader] ϸ, 𸣴 Type ڵ Sizeŭ ǳʶٸ ȴ
+// LogSite ڵ  ȣ ġ ù α׺    ϵǰ, α ڵ SiteID װ Ų
+////////////////////////////////////////////////
+namespace BinaryLogFile
+{
+    constexpr uint32_t MAGIC = 0x474F4C42;  // "BLOG"
+    constexpr uint32_t VERSION = 1;
+
+    enum ERecordType : uint16_t
+    {
+        RECORD_SITE = 1,    // [SiteRecord][ELogArgKind * ArgCount][ ڿ][ϸ]
+        RECORD_LOG,         // [LogRecord][ڵ ڵ]
+        RECORD_TEXT,        // [RecordHeader][ϼ α ڿ (  )]
+    };
+
+#pragma pack(push, 1)
+    struct FileHeader
+    {
+        uint32_t    Magic;
+        uint32_t    Version;
+    };
+
+    struct RecordHeader
+    {
+        uint16_t    Type;
+        uint16_t    Size;   //   ڵ ü ũ (bytes)
+    };
+
+    struct SiteRecord
+    {
+        RecordHeader    Header;
+        uint32_t        SiteID;
+        int32_t         Line;
+        uint8_t         Level;
+        uint8_t         ArgCount;
+        uint16_t        FormatLength;       //  
+        uint16_t        FileNameLength;     //  
+    };
+
+    struct LogRecord
+    {
+        RecordHeader    Header;
+        uint32_t        SiteID;
+        uint64_t        Time;               // FILETIME (UTC)
+    };
+#pragma pack(pop)
+}
@@ -2,40 +2,491 @@
 
 #include "Logger.h"
 
+#include <algorithm>
+#include <string>
 #include <time.h>
+#include <unordered_map>
+#include <vector>
 #include <Windows.h>
+#include <process.h>
 #include <strsafe.h>
 
+#include "../DataStructure/SpscRecordRing.h"
+#include "LogArchive.h"
+
 #define LOG_MESSAGE_MAX_LENGTH 512
 #define DAY_INFO_BUFFER_LENGTH 16
 
+#define LOG_RING_SIZE (64 * 1024)			// 庰 α  ũ (bytes)
+#define LOG_BATCH_SIZE (32 * 1024)			// α 尡   WriteFile  ִ ũ (bytes)
+#define LOG_RECORD_MAX_SIZE 2048			//  ڵ ϳ ִ ũ (   ÿ  ũ)
+#define LOG_WRITER_WAKE_INTERVAL_MS 50		//   ̻  ʾƵ α 尡   ֱ
+#define LOG_SUPPRESS_SUMMARY_INTERVAL_MS 5000	// LOGF_LIMITED  α  ؼ  ֱ
+
+namespace
+{
+	// 庰 α  - ڵ [ELogTarget 1][α ڿ (  )] Ǵ [BinaryRingRecord][ڵ ڵ]
+	struct ThreadLogRing
+	{
+		SpscRecordRing	Ring;
+		volatile LONG	bRetired;	// 尡  (α 尡  α׸   )
+		ThreadLogRing*	Next;
+	};
+
+	// LOGF α  ڵ
+	struct BinaryRingRecord
+	{
+		WCHAR			Target;		// ELogTarget::BinaryLog
+		const LogSite*	Site;
+		uint64_t		Time;		// FILETIME (UTC)
+	};
+
+	// Ƽ    α
+	struct LogBatch
+	{
+		char		Buffer[LOG_BATCH_SIZE];
+		uint32_t	Size;
+	};
+
+	// ƮǴ α  (Prefix_YYYYMMDD_hhmmss.Extension) - α / ͸ α / ̳ʸ α   Ʈȴ
+	struct LogFile
+	{
+		const WCHAR*	Prefix;
+		const WCHAR*	Extension;
+		bool			bBinary;			// BOM  BinaryLogFile::FileHeader ϴ .blog 
+		HANDLE			hFile;
+		WCHAR			FileName[MAX_PATH];
+		uint32_t		OpenDay;			//   ¥ ( ð YYYYMMDD)
+		uint64_t		FileSize;			// Ͽ  Ʈ  (Batch   )
+		uint64_t		BytesSinceFlush;
+		uint64_t		LastFlushTick;
+		LogBatch		Batch;
+	};
+
+	static_assert(sizeof(BinaryRingRecord) + LogFormatter::MAX_ARGS_SIZE <= LOG_RECORD_MAX_SIZE, "LOG_RECORD_MAX_SIZE is too small");
+	static_assert((LOG_MESSAGE_MAX_LENGTH + 1) * sizeof(WCHAR) <= LOG_RECORD_MAX_SIZE, "LOG_RECORD_MAX_SIZE is too small");
+
+	SRWLOCK g_writeLock = SRWLOCK_INIT;		//   Ͽ   (α  /  α)   ϳ
+	ThreadLogRing* g_ringList;				// ϵ  (g_writeLock ȣ)
+	uint64_t g_reportedDropCount;
+
+	//  ̶ α׸  LOGF_LIMITED ȣ ġ (  ϸ ϰ  )
+	LogLimiter* volatile g_limiterList;
+	uint64_t g_lastSuppressSummaryTick;
+
+	LogBatch g_consoleBatch;
+	LogFile g_logFile = { L"Log", L"txt", false };
+	LogFile g_monitorFile = { L"Monitor", L"txt", false };
+	LogFile g_binaryLogFile = { L"Log", L"blog", true };
+
+	WCHAR g_logDirectory[MAX_PATH];							// α ϵ ִ 丮
+	std::unordered_map<const LogSite*, uint32_t> g_siteIDs;	//  .blog Ͽ  LogSite -> SiteID
+	uint32_t g_today;										// ¥  Ʈ   ¥ (drainRings() )
+
+	//   - ƮǾ   ϰ      (α 尡 ٸ ʵ  )
+	SRWLOCK g_archiveLock = SRWLOCK_INIT;
+	std::vector<std::wstring> g_archiveJobs;				//  ϵ (g_archiveLock ȣ)
+	HANDLE g_hArchiveThread;
+	HANDLE g_hArchiveWakeEvent;
+	volatile bool g_bArchiveRunning;
+
+	// α 尡    ð ڿ (ʰ ٲ   )
+	uint64_t g_timeInfoSecond;
+	WCHAR g_timeInfo[LogFormatter::TIME_INFO_LENGTH];
+
+	// 尡    α 忡 ѱ
+	struct ThreadLogRingHolder
+	{
+		ThreadLogRing* Ring = nullptr;
+
+		~ThreadLogRingHolder()
+		{
+			if (Ring != nullptr)
+			{
+				InterlockedExchange(&Ring->bRetired, TRUE);
+			}
+		}
+	};
+
+	thread_local ThreadLogRingHolder t_ringHolder;
+
+	//    (ó α   )
+	ThreadLogRing* getThreadLogRing(void)
+	{
+		if (t_ringHolder.Ring == nullptr)
+		{
+			ThreadLogRing* threadRing = new ThreadLogRing;
+			threadRing->Ring.Init(LOG_RING_SIZE);
+			threadRing->bRetired = FALSE;
+
+			AcquireSRWLockExclusive(&g_writeLock);
+
+			threadRing->Next = g_ringList;
+			g_ringList = threadRing;
+
+			ReleaseSRWLockExclusive(&g_writeLock);
+
+			t_ringHolder.Ring = threadRing;
+		}
+
+		return t_ringHolder.Ring;
+	}
+
+	inline uint32_t getDay(const SYSTEMTIME& localTime)
+	{
+		return localTime.wYear * 10000u + localTime.wMonth * 100u + localTime.wDay;
+	}
+
+	inline uint32_t getToday(void)
+	{
+		SYSTEMTIME localTime;
+		GetLocalTime(&localTime);
+
+		return getDay(localTime);
+	}
+
+	//    BOM(ؽƮ) Ǵ FileHeader(̳ʸ)  ( ʿ   ƮǾٸ ϸ  _1, _2 ...  )
+	// ϸ file ״ д
+	bool openLogFile(LogFile& file)
+	{
+		SYSTEMTIME localTime;
+		GetLocalTime(&localTime);
+
+		WCHAR fileName[MAX_PATH];
+		HANDLE hFile = INVALID_HANDLE_VALUE;
+		DWORD error = ERROR_FILE_EXISTS;
+
+		for (uint32_t sequence = 0; sequence < 100 && error == ERROR_FILE_EXISTS; ++sequence)
+		{
+			WCHAR suffix[8] = L"";
+
+			if (sequence > 0)
+			{
+				StringCchPrintfW(suffix, _countof(suffix), L"_%u", sequence);
+			}
+
+			StringCchPrintfW(fileName, MAX_PATH, L"%s\\%s_%04d%02d%02d_%02d%02d%02d%s.%s", g_logDirectory, file.Prefix,
+				localTime.wYear, localTime.wMonth, localTime.wDay, localTime.wHour, localTime.wMinute, localTime.wSecond, suffix, file.Extension);
+
+			hFile = ::CreateFile(fileName, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_NEW, FILE_ATTRIBUTE_NORMAL, nullptr);
+			error = (hFile == INVALID_HANDLE_VALUE) ? GetLastError() : ERROR_SUCCESS;
+		}
+
+		if (hFile == INVALID_HANDLE_VALUE)
+		{
+			wprintf(L"[!] %s CreateFile() Failed %d\n", fileName, error);
+			return false;
+		}
+
+		if (file.bBinary)
+		{
+			const BinaryLogFile::FileHeader fileHeader = { BinaryLogFile::MAGIC, BinaryLogFile::VERSION };
+			WriteFile(hFile, &fileHeader, sizeof(fileHeader), nullptr, nullptr);
+
+			file.FileSize = sizeof(fileHeader);
+
+			//  .blog  SITE ڵ ٽ ܼ  ϳ ȯ  ְ Ѵ
+			g_siteIDs.clear();
+		}
+		else
+		{
+			constexpr unsigned short BOM_UTF_16_LE = 0xFEFF;
+			WriteFile(hFile, &BOM_UTF_16_LE, sizeof(BOM_UTF_16_LE), nullptr, nullptr);
+
+			file.FileSize = sizeof(BOM_UTF_16_LE);
+		}
+
+		StringCchCopyW(file.FileName, MAX_PATH, fileName);
+		file.hFile = hFile;
+		file.OpenDay = getDay(localTime);
+		file.BytesSinceFlush = 0;
+		file.LastFlushTick = GetTickCount64();
+
+		return true;
+	}
+
+	void writeConsole(void)
+	{
+		if (g_consoleBatch.Size == 0)
+		{
+			return;
+		}
+
+		wprintf(L"%.*s", static_cast<int>(g_consoleBatch.Size / sizeof(WCHAR)), reinterpret_cast<const WCHAR*>(g_consoleBatch.Buffer));
+
+		g_consoleBatch.Size = 0;
+	}
+
+	void writeLogFile(LogFile& file)
+	{
+		if (file.Batch.Size == 0)
+		{
+			return;
+		}
+
+		if (WriteFile(file.hFile, file.Batch.Buffer, file.Batch.Size, nullptr, nullptr) == FALSE)
+		{
+			wprintf(L"[!] File Logging ERROR - GetLastError() = %d\n", GetLastError());
+		}
+
+		file.FileSize += file.Batch.Size;
+		file.BytesSinceFlush += file.Batch.Size;
+		file.Batch.Size = 0;
+	}
+
+	void appendToConsole(const WCHAR* log, uint32_t length)
+	{
+		const uint32_t size = length * sizeof(WCHAR);
+
+		if (g_consoleBatch.Size + size > LOG_BATCH_SIZE)
+		{
+			writeConsole();
+		}
+
+		memcpy(g_consoleBatch.Buffer + g_consoleBatch.Size, log, size);
+		g_consoleBatch.Size += size;
+	}
+
+	void appendToLogFile(LogFile& file, const void* data, uint32_t size)
+	{
+		if (file.Batch.Size + size > LOG_BATCH_SIZE)
+		{
+			writeLogFile(file);
+		}
+
+		memcpy(file.Batch.Buffer + file.Batch.Size, data, size);
+		file.Batch.Size += size;
+	}
+
+	inline void appendToLogFile(LogFile& file, const WCHAR* log, uint32_t length)
+	{
+		appendToLogFile(file, static_cast<const void*>(log), length * sizeof(WCHAR));
+	}
+
+	// ũ / ¥  Ѿٸ  Ϸ Ѿ,    忡 ѱ
+	// ڵ带   ȣؾ .blog  SITE / LOG ڵ尡  Ͽ  ʴ´
+	void rotateIfNeeded(LogFile& file, uint64_t rotateBytes, bool bDaily)
+	{
+		const bool bSizeExceeded = (rotateBytes > 0 && file.FileSize + file.Batch.Size >= rotateBytes);
+		const bool bDayChanged = (bDaily && file.OpenDay < g_today);
+
+		if (false == bSizeExceeded && false == bDayChanged)
+		{
+			return;
+		}
+
+		writeLogFile(file);
+		FlushFileBuffers(file.hFile);
+
+		const HANDLE hOldFile = file.hFile;
+		const std::wstring oldFileName = file.FileName;
+
+		if (false == openLogFile(file))
+		{
+			//    ߴٸ  ر  Ͽ ̾ 
+			file.FileSize = 0;
+			file.OpenDay = g_today;
+			return;
+		}
+
+		CloseHandle(hOldFile);
+
+		AcquireSRWLockExclusive(&g_archiveLock);
+
+		g_archiveJobs.push_back(oldFileName);
+
+		ReleaseSRWLockExclusive(&g_archiveLock);
+
+		SetEvent(g_hArchiveWakeEvent);
+	}
+
+	// ó ϴ LogSite  SITE ڵ带  SiteID ش
+	uint32_t appendSiteRecord(LogFile& file, const LogSite* site)
+	{
+		auto it = g_siteIDs.find(site);
+
+		if (it != g_siteIDs.end())
+		{
+			return it->second;
+		}
+
+		const uint32_t siteID = static_cast<uint32_t>(g_siteIDs.size());
+		g_siteIDs.emplace(site, siteID);
+
+		BinaryLogFile::SiteRecord record;
+		record.SiteID = siteID;
+		record.Line = site->Line;
+		record.Level = static_cast<uint8_t>(site->Level);
+		record.ArgCount = static_cast<uint8_t>(site->ArgCount);
+		record.FormatLength = static_cast<uint16_t>(wcslen(site->Format));
+		record.FileNameLength = static_cast<uint16_t>(wcslen(site->FileName));
+		record.Header.Type = BinaryLogFile::RECORD_SITE;
+		record.Header.Size = static_cast<uint16_t>(sizeof(record) + record.ArgCount * sizeof(ELogArgKind) + (record.FormatLength + record.FileNameLength) * sizeof(WCHAR));
+
+		appendToLogFile(file, &record, sizeof(record));
+		appendToLogFile(file, site->ArgKinds, record.ArgCount * sizeof(ELogArgKind));
+		appendToLogFile(file, site->Format, record.FormatLength);
+		appendToLogFile(file, site->FileName, record.FileNameLength);
+
+		return siteID;
+	}
+
+	void appendBinaryLog(LogFile& file, const BinaryRingRecord& ringRecord, const char* encodedArgs, uint32_t size)
+	{
+		BinaryLogFile::LogRecord record;
+		record.SiteID = appendSiteRecord(file, ringRecord.Site);
+		record.Time = ringRecord.Time;
+		record.Header.Type = BinaryLogFile::RECORD_LOG;
+		record.Header.Size = static_cast<uint16_t>(sizeof(record) + size);
+
+		appendToLogFile(file, &record, sizeof(record));
+		appendToLogFile(file, encodedArgs, size);
+	}
+
+	// ؽƮ α    (.blog ̶ TEXT ڵ)
+	void appendLine(LogFile& file, const WCHAR* log, uint32_t length)
+	{
+		if (false == file.bBinary)
+		{
+			appendToLogFile(file, log, length);
+			return;
+		}
+
+		BinaryLogFile::RecordHeader header;
+		header.Type = BinaryLogFile::RECORD_TEXT;
+		header.Size = static_cast<uint16_t>(sizeof(header) + length * sizeof(WCHAR));
+
+		appendToLogFile(file, &header, sizeof(header));
+		appendToLogFile(file, log, length);
+	}
+
+	// LOGF α׸ ؽƮ  ٷ 
+	uint32_t formatBinaryLog(WCHAR* outLog, const BinaryRingRecord& ringRecord, const char* encodedArgs, uint32_t size)
+	{
+		const uint64_t second = ringRecord.Time / 10000000ull;
+
+		if (second != g_timeInfoSecond)
+		{
+			LogFormatter::GetTimeInfo(ringRecord.Time, g_timeInfo);
+			g_timeInfoSecond = second;
+		}
+
+		const LogSite* site = ringRecord.Site;
+
+		return LogFormatter::FormatLine(outLog, LOG_MESSAGE_MAX_LENGTH, g_timeInfo, site->Format, site->ArgKinds, site->ArgCount, encodedArgs, size);
+	}
+
+	void flushFileIfNeeded(LogFile& file, bool bForceFlush, uint32_t intervalMs, uint32_t bytes)
+	{
+		if (file.BytesSinceFlush == 0)
+		{
+			return;
+		}
+
+		const uint64_t currentTick = GetTickCount64();
+
+		if (bForceFlush || file.BytesSinceFlush >= bytes || currentTick - file.LastFlushTick >= intervalMs)
+		{
+			FlushFileBuffers(file.hFile);
+			file.BytesSinceFlush = 0;
+			file.LastFlushTick = currentTick;
+		}
+	}
+
+	// α 丮 prefix_*   days Ѱ  ʾҰų,  ͺ (ϸ ) ļ maxBytes Ѵ ͵ 
+	//  ִ  FILE_SHARE_DELETE   Ƿ DeleteFile ؼ ´
+	void applyRetention(const WCHAR* prefix, uint32_t days, uint64_t maxBytes)
+	{
+		if (days == 0 && maxBytes == 0)
+		{
+			return;
+		}
+
+		struct FileInfo
+		{
+			std::wstring	FileName;
+			uint64_t		Size;
+			uint64_t		LastWriteTime;
+		};
+
+		WCHAR pattern[MAX_PATH];
+		StringCchPrintfW(pattern, MAX_PATH, L"%s\\%s_*", g_logDirectory, prefix);
+
+		WIN32_FIND_DATAW findData;
+		HANDLE hFind = FindFirstFileW(pattern, &findData);
+
+		if (hFind == INVALID_HANDLE_VALUE)
+		{
+			return;
+		}
+
+		std::vector<FileInfo> files;
+		uint64_t totalSize = 0;
+
+		do
+		{
+			if (findData.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+			{
+				continue;
+			}
+
+			FileInfo fileInfo;
+			fileInfo.FileName = findData.cFileName;
+			fileInfo.Size = (static_cast<uint64_t>(findData.nFileSizeHigh) << 32) | findData.nFileSizeLow;
+			fileInfo.LastWriteTime = (static_cast<uint64_t>(findData.ftLastWriteTime.dwHighDateTime) << 32) | findData.ftLastWriteTime.dwLowDateTime;
+
+			totalSize += fileInfo.Size;
+			files.push_back(std::move(fileInfo));
+		} while (FindNextFileW(hFind, &findData));
+
+		FindClose(hFind);
+
+		// ϸ  ð Ƿ ̸    
+		std::sort(files.begin(), files.end(), [](const FileInfo& lhs, const FileInfo& rhs) { return lhs.FileName < rhs.FileName; });
+
+		FILETIME fileTime;
+		GetSystemTimeAsFileTime(&fileTime);
+
+		const uint64_t currentTime = (static_cast<uint64_t>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime;
+		const uint64_t retentionTime = days * 24ull * 60 * 60 * 10000000ull;
+
+		for (const FileInfo& fileInfo : files)
+		{
+			const bool bExpired = (days > 0 && fileInfo.LastWriteTime + retentionTime < currentTime);
+			const bool bOverSize = (maxBytes > 0 && totalSize > maxBytes);
+
+			if (false == bExpired && false == bOverSize)
+			{
+				continue;
+			}
+
+			WCHAR fileName[MAX_PATH];
+			StringCchPrintfW(fileName, MAX_PATH, L"%s\\%s", g_logDirectory, fileInfo.FileName.c_str());
+
+			if (DeleteFileW(fileName))
+			{
+				totalSize -= fileInfo.Size;
+			}
+		}
+	}
+}
+
+//  /  (  ) ڿ ؾ Ҹڿ  α׸     ִ
 Logger Logger::mInstance;
-HANDLE Logger::mhLogFile;
-HANDLE Logger::mhMonitorFile;
+volatile bool Logger::mbBinaryLog;
 ELogLevel Logger::mLogLevel = ELogLevel::Debug;
-
-// ֿܼ α׸ 
-#define LOG_TO_CONSOLE(Log) wprintf(Log)
-
-// α Ͽ α׸ 
-#define LOG_TO_LOG_FILE(Log) do {																				\
-	if (WriteFile(mhLogFile, (Log), (DWORD)(wcslen(Log) * sizeof(WCHAR)), nullptr, nullptr) == FALSE)			\
-	{																											\
-		wprintf(L"[!] File Logging ERROR - GetLastError() = %d\n", GetLastError());								\
-	}																											\
-																												\
-	FlushFileBuffers(mhLogFile);																				\
-} while (false)																									\
-
-// ͸ Ͽ α׸ 
-#define LOG_TO_MONITOR_FILE(Log) do {																			\
-	if (WriteFile(mhMonitorFile, (Log), (DWORD)(wcslen(Log) * sizeof(WCHAR)), nullptr, nullptr) == FALSE)		\
-	{																											\
-		wprintf(L"[!] File Logging ERROR - GetLastError() = %d\n", GetLastError());								\
-	}																											\
-																												\
-	FlushFileBuffers(mhMonitorFile);																			\
-} while (false)																									\
+ELogOverflowPolicy Logger::mOverflowPolicy = ELogOverflowPolicy::Drop;
+uint32_t Logger::mFlushIntervalMs = 1000;
+uint32_t Logger::mFlushBytes = 64 * 1024;
+uint64_t Logger::mRotateBytes = 64ull * 1024 * 1024;
+bool Logger::mbRotateDaily = true;
+bool Logger::mbArchiveCompression = true;
+uint32_t Logger::mRetentionDays;
+uint64_t Logger::mRetentionBytes;
+volatile uint64_t Logger::mDroppedLogCount;
+HANDLE Logger::mhWriterThread;
+HANDLE Logger::mhWriterWakeEvent;
+volatile bool Logger::mbWriterRunning;
 
 void Logger::LogMonitor(const WCHAR * formatMessage, ...)
 {
@@ -52,8 +503,7 @@ void Logger::LogMonitor(const WCHAR * formatMessage, ...)
 
 	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"%s\n", completedMessage);
 
-	LOG_TO_CONSOLE(log);
-	LOG_TO_MONITOR_FILE(log);
+	writeLog(ELogTarget::MonitorFile, log, false);
 }
 
 void Logger::LogMessage(ELogLevel logLevel, const WCHAR * message)
@@ -67,8 +517,7 @@ void Logger::LogMessage(ELogLevel logLevel, const WCHAR * message)
 
 	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"%s\n", message);
 
-	LOG_TO_CONSOLE(log);
-	LOG_TO_LOG_FILE(log);
+	writeLog(ELogTarget::LogFile, log, logLevel == ELogLevel::Assert);
 }
 
 void Logger::LogMessageWithTime(ELogLevel logLevel, const WCHAR* message)
@@ -84,8 +533,7 @@ void Logger::LogMessageWithTime(ELogLevel logLevel, const WCHAR* message)
 
 	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%s] : %s\n", dayInfo, message);
 
-	LOG_TO_CONSOLE(log);
-	LOG_TO_LOG_FILE(log);
+	writeLog(ELogTarget::LogFile, log, logLevel == ELogLevel::Assert);
 }
 
 void Logger::LogMessageWithTime(ELogLevel logLevel, const WCHAR* message, const WCHAR* fileName, int line)
@@ -101,8 +549,7 @@ void Logger::LogMessageWithTime(ELogLevel logLevel, const WCHAR* message, const
 
 	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%s][%s line:%4d] : %s\n", dayInfo, fileName, line, message);
 
-	LOG_TO_CONSOLE(log);
-	LOG_TO_LOG_FILE(log);
+	writeLog(ELogTarget::LogFile, log, logLevel == ELogLevel::Assert);
 }
 
 void Logger::LogFormat(ELogLevel logLevel, const WCHAR* formatMessage, ...)
@@ -132,8 +579,7 @@ void Logger::LogCurrentTime(void)
 
 	StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"<%s>\n", dayInfo);
 
-	LOG_TO_CONSOLE(log);
-	LOG_TO_MONITOR_FILE(log);
+	writeLog(ELogTarget::MonitorFile, log, false);
 }
 
 void Logger::LogFormatWithTime(ELogLevel logLevel, const WCHAR* formatMessage, ...)
@@ -155,6 +601,389 @@ void Logger::LogFormatWithTime(ELogLevel logLevel, const WCHAR* formatMessage, .
 	Logger::LogMessageWithTime(logLevel, completedMessage);
 }
 
+bool Logger::TryAcquireLogToken(LogLimiter& limiter)
+{
+	const int64_t interval = 1000000 / limiter.LogsPerSecond;
+	const int64_t burst = interval * limiter.LogsPerSecond;
+	const int64_t currentTime = static_cast<int64_t>(GetTickCount64()) * 1000;
+
+	int64_t nextTime = limiter.NextTime;
+
+	for (;;)
+	{
+		const int64_t newNextTime = ((nextTime > currentTime) ? nextTime : currentTime) + interval;
+
+		if (newNextTime - currentTime > burst)
+		{
+			break;
+		}
+
+		const int64_t prevNextTime = InterlockedCompareExchange64(reinterpret_cast<volatile LONG64*>(&limiter.NextTime), newNextTime, nextTime);
+
+		if (prevNextTime == nextTime)
+		{
+			return true;
+		}
+
+		nextTime = prevNextTime;
+	}
+
+	InterlockedIncrement(&limiter.SuppressedCount);
+
+	// ó  ȣ ġ  Ͽ ִ´
+	if (limiter.bListed == FALSE && InterlockedExchange(&limiter.bListed, TRUE) == FALSE)
+	{
+		LogLimiter* head = g_limiterList;
+
+		do
+		{
+			limiter.Next = head;
+			head = reinterpret_cast<LogLimiter*>(InterlockedCompareExchangePointer(reinterpret_cast<PVOID volatile*>(&g_limiterList), &limiter, limiter.Next));
+		} while (head != limiter.Next);
+	}
+
+	return false;
+}
+
+void Logger::SetBinaryLog(bool bBinaryLog)
+{
+	AcquireSRWLockExclusive(&g_writeLock);
+
+	// ٲٱ   α״  Ͽ 
+	drainRings();
+	writeBatches(true);
+
+	if (bBinaryLog && g_binaryLogFile.hFile == nullptr)
+	{
+		openLogFile(g_binaryLogFile);
+	}
+
+	mbBinaryLog = bBinaryLog && g_binaryLogFile.hFile != nullptr;
+
+	ReleaseSRWLockExclusive(&g_writeLock);
+}
+
+void Logger::SetRetentionPolicy(uint32_t days, uint32_t maxMB)
+{
+	mRetentionDays = days;
+	mRetentionBytes = static_cast<uint64_t>(maxMB) * 1024 * 1024;
+
+	//    ϵ鵵 ٷ Ѵ
+	SetEvent(g_hArchiveWakeEvent);
+}
+
+void Logger::Flush(void)
+{
+	AcquireSRWLockExclusive(&g_writeLock);
+
+	drainRings();
+	writeBatches(true);
+
+	ReleaseSRWLockExclusive(&g_writeLock);
+}
+
+void Logger::FlushOnCrash(void)
+{
+	for (int retry = 0; retry < 100; ++retry)
+	{
+		if (TryAcquireSRWLockExclusive(&g_writeLock))
+		{
+			drainRings();
+			writeBatches(true);
+
+			ReleaseSRWLockExclusive(&g_writeLock);
+			return;
+		}
+
+		Sleep(1);
+	}
+}
+
+void Logger::writeLog(ELogTarget target, const WCHAR* log, bool bSync)
+{
+	const WCHAR header = static_cast<WCHAR>(target);
+
+	writeRecord(&header, sizeof(header), log, static_cast<uint32_t>(wcslen(log)) * sizeof(WCHAR), bSync);
+}
+
+void Logger::writeBinaryLog(const LogSite& site, const char* encodedArgs, uint32_t size)
+{
+	FILETIME fileTime;
+	GetSystemTimeAsFileTime(&fileTime);
+
+	BinaryRingRecord header;
+	header.Target = static_cast<WCHAR>(ELogTarget::BinaryLog);
+	header.Site = &site;
+	header.Time = (static_cast<uint64_t>(fileTime.dwHighDateTime) << 32) | fileTime.dwLowDateTime;
+
+	writeRecord(&header, sizeof(header), encodedArgs, size, site.Level == ELogLevel::Assert);
+}
+
+void Logger::writeRecord(const void* header, uint32_t headerSize, const void* body, uint32_t bodySize, bool bSync)
+{
+	const uint32_t recordSize = headerSize + bodySize;
+
+	if (false == bSync && mbWriterRunning)
+	{
+		ThreadLogRing* threadRing = getThreadLogRing();
+
+		for (;;)
+		{
+			char* record = reinterpret_cast<char*>(threadRing->Ring.TryReserve(recordSize));
+
+			if (record != nullptr)
+			{
+				memcpy(record, header, headerSize);
+				memcpy(record + headerSize, body, bodySize);
+				threadRing->Ring.Commit();
+
+				//  ̻ áٸ ֱ⸦ ٸ ʰ α 带 
+				if (threadRing->Ring.GetUseSize() >= threadRing->Ring.GetCapacity() / 2)
+				{
+					SetEvent(mhWriterWakeEvent);
+				}
+
+				return;
+			}
+
+			SetEvent(mhWriterWakeEvent);
+
+			if (mOverflowPolicy == ELogOverflowPolicy::Drop)
+			{
+				InterlockedIncrement64(reinterpret_cast<volatile LONG64*>(&mDroppedLogCount));
+				return;
+			}
+
+			// ٸ  α 尡 Ǿٸ Ʒ  
+			if (false == mbWriterRunning)
+			{
+				break;
+			}
+
+			Sleep(1);
+		}
+	}
+
+	// α 尡 ų (  /  )  α - ռ  α׸   ̾ 
+	char record[LOG_RECORD_MAX_SIZE];
+	memcpy(record, header, headerSize);
+	memcpy(record + headerSize, body, bodySize);
+
+	AcquireSRWLockExclusive(&g_writeLock);
+
+	drainRings();
+	appendRecord(record, recordSize);
+	writeBatches(true);
+
+	ReleaseSRWLockExclusive(&g_writeLock);
+}
+
+void Logger::appendRecord(const char* record, uint32_t size)
+{
+	const ELogTarget target = static_cast<ELogTarget>(*reinterpret_cast<const WCHAR*>(record));
+
+	if (target == ELogTarget::BinaryLog)
+	{
+		BinaryRingRecord ringRecord;
+		memcpy(&ringRecord, record, sizeof(ringRecord));
+
+		const char* encodedArgs = record + sizeof(ringRecord);
+		const uint32_t argsSize = size - sizeof(ringRecord);
+
+		WCHAR log[LOG_MESSAGE_MAX_LENGTH];
+		const uint32_t length = formatBinaryLog(log, ringRecord, encodedArgs, argsSize);
+
+		appendToConsole(log, length);
+
+		LogFile& file = mbBinaryLog ? g_binaryLogFile : g_logFile;
+		rotateIfNeeded(file, mRotateBytes, mbRotateDaily);
+
+		if (file.bBinary)
+		{
+			appendBinaryLog(file, ringRecord, encodedArgs, argsSize);
+		}
+		else
+		{
+			appendToLogFile(file, log, length);
+		}
+
+		return;
+	}
+
+	const WCHAR* log = reinterpret_cast<const WCHAR*>(record) + 1;
+	const uint32_t length = size / sizeof(WCHAR) - 1;
+
+	appendToConsole(log, length);
+
+	LogFile& file = (target == ELogTarget::MonitorFile) ? g_monitorFile : (mbBinaryLog ? g_binaryLogFile : g_logFile);
+	rotateIfNeeded(file, mRotateBytes, mbRotateDaily);
+
+	appendLine(file, log, length);
+}
+
+void Logger::drainRings(void)
+{
+	g_today = getToday();
+
+	ThreadLogRing** link = &g_ringList;
+
+	while (*link != nullptr)
+	{
+		ThreadLogRing* threadRing = *link;
+
+		//  ǥø  о    αױ      ִ
+		const bool bRetired = (threadRing->bRetired != FALSE);
+
+		threadRing->Ring.Drain(appendRecord);
+
+		if (bRetired)
+		{
+			*link = threadRing->Next;
+			delete threadRing;
+		}
+		else
+		{
+			link = &threadRing->Next;
+		}
+	}
+
+	//     αװ ִٸ 
+	const uint64_t droppedLogCount = mDroppedLogCount;
+
+	if (droppedLogCount != g_reportedDropCount)
+	{
+		WCHAR log[LOG_MESSAGE_MAX_LENGTH];
+		StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[!] %llu logs dropped (log ring full)\n", droppedLogCount - g_reportedDropCount);
+
+		const uint32_t length = static_cast<uint32_t>(wcslen(log));
+
+		appendToConsole(log, length);
+
+		LogFile& file = mbBinaryLog ? g_binaryLogFile : g_logFile;
+		rotateIfNeeded(file, mRotateBytes, mbRotateDaily);
+
+		appendLine(file, log, length);
+
+		g_reportedDropCount = droppedLogCount;
+	}
+
+	// LOGF_LIMITED  αװ ִٸ ȣ ġ ؼ 
+	const uint64_t currentTick = GetTickCount64();
+
+	if (currentTick - g_lastSuppressSummaryTick >= LOG_SUPPRESS_SUMMARY_INTERVAL_MS)
+	{
+		g_lastSuppressSummaryTick = currentTick;
+
+		for (LogLimiter* limiter = g_limiterList; limiter != nullptr; limiter = limiter->Next)
+		{
+			const long suppressedCount = InterlockedExchange(&limiter->SuppressedCount, 0);
+
+			if (suppressedCount == 0)
+			{
+				continue;
+			}
+
+			WCHAR dayInfo[DAY_INFO_BUFFER_LENGTH];
+			getCurrentTimeInfo(dayInfo);
+
+			WCHAR log[LOG_MESSAGE_MAX_LENGTH];
+			StringCchPrintfW(log, LOG_MESSAGE_MAX_LENGTH, L"[%s][%s line:%4d] : suppressed %ld similar messages (%s)\n",
+				dayInfo, limiter->Site->FileName, limiter->Site->Line, suppressedCount, limiter->Site->Format);
+
+			const uint32_t length = static_cast<uint32_t>(wcslen(log));
+
+			appendToConsole(log, length);
+
+			LogFile& file = mbBinaryLog ? g_binaryLogFile : g_logFile;
+			rotateIfNeeded(file, mRotateBytes, mbRotateDaily);
+
+			appendLine(file, log, length);
+		}
+	}
+}
+
+void Logger::writeBatches(bool bForceFlush)
+{
+	writeConsole();
+	writeLogFile(g_logFile);
+	writeLogFile(g_monitorFile);
+	writeLogFile(g_binaryLogFile);
+
+	flushFileIfNeeded(g_logFile, bForceFlush, mFlushIntervalMs, mFlushBytes);
+	flushFileIfNeeded(g_monitorFile, bForceFlush, mFlushIntervalMs, mFlushBytes);
+	flushFileIfNeeded(g_binaryLogFile, bForceFlush, mFlushIntervalMs, mFlushBytes);
+}
+
+unsigned int Logger::writerThread(void* param)
+{
+	while (mbWriterRunning)
+	{
+		WaitForSingleObject(mhWriterWakeEvent, LOG_WRITER_WAKE_INTERVAL_MS);
+
+		AcquireSRWLockExclusive(&g_writeLock);
+
+		drainRings();
+		writeBatches(false);
+
+		ReleaseSRWLockExclusive(&g_writeLock);
+	}
+
+	return 0;
+}
+
+unsigned int Logger::archiveThread(void* param)
+{
+	SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+
+	std::vector<std::wstring> jobs;
+
+	for (;;)
+	{
+		WaitForSingleObject(g_hArchiveWakeEvent, INFINITE);
+
+		//  ǥø  о   Ѱܹ ϱ  óϰ 
+		const bool bRunning = g_bArchiveRunning;
+
+		AcquireSRWLockExclusive(&g_archiveLock);
+
+		jobs.swap(g_archiveJobs);
+
+		ReleaseSRWLockExclusive(&g_archiveLock);
+
+		for (const std::wstring& fileName : jobs)
+		{
+			if (false == mbArchiveCompression)
+			{
+				continue;
+			}
+
+			const std::wstring archiveFileName = fileName + LogArchive::EXTENSION;
+
+			if (LogArchive::CompressFile(fileName.c_str(), archiveFileName.c_str()))
+			{
+				DeleteFileW(fileName.c_str());
+			}
+			else
+			{
+				wprintf(L"[!] Log Archive Failed %s - GetLastError() = %d\n", fileName.c_str(), GetLastError());
+			}
+		}
+
+		jobs.clear();
+
+		// α ϰ ͸ α     Ѵ
+		applyRetention(g_logFile.Prefix, mRetentionDays, mRetentionBytes);
+		applyRetention(g_monitorFile.Prefix, mRetentionDays, mRetentionBytes);
+
+		if (false == bRunning)
+		{
+			break;
+		}
+	}
+
+	return 0;
+}
+
 void Logger::getCurrentTimeInfo(WCHAR* outBuffer)
 {
 	time_t startTime = time(nullptr);
@@ -185,10 +1014,6 @@ Logger::Logger()
 
 	WCHAR fileName[_MAX_PATH * 2];
 
-	// get logFileName
-	WCHAR dayInfo[DAY_INFO_BUFFER_LENGTH];
-	getCurrentTimeInfo(dayInfo);
-
 	// get process path
 	DWORD dwPID = GetCurrentProcessId();
 	HANDLE hProcess = OpenProcess(PROCESS_QUERY_INFORMATION | PROCESS_VM_READ, FALSE, dwPID);
@@ -204,30 +1029,56 @@ Logger::Logger()
 	CreateDirectoryW(fileName, nullptr); // create directory
 
 	wsprintfW(processPath, L"%s", fileName); // path update (log file directory)
+	wsprintfW(g_logDirectory, L"%s", processPath);
+
+	g_today = getToday();
 
-	wsprintfW(fileName, L"%s\\Log_%s.txt", processPath, dayInfo);
-	mhLogFile = ::CreateFile(fileName, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
-	if (mhLogFile == INVALID_HANDLE_VALUE)
+	if (false == openLogFile(g_logFile))
 	{
-		printf("Log File CreateFile() Failed %d\n", GetLastError());
+		printf("Log File CreateFile() Failed\n");
 		RaiseCrash();
 	}
 
-	wsprintfW(fileName, L"%s\\Monitor_%s.txt", processPath, dayInfo);
-	mhMonitorFile = ::CreateFile(fileName, GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
-	if (mhMonitorFile == INVALID_HANDLE_VALUE)
+	if (false == openLogFile(g_monitorFile))
 	{
-		printf("Monitoring Log File CreateFile() Failed %d\n", GetLastError());
+		printf("Monitoring Log File CreateFile() Failed\n");
 		RaiseCrash();
 	}
 
-	// Write BOM
-	constexpr unsigned short BOM_UTF_16_LE = 0xFEFF;
-	WriteFile(mhLogFile, &BOM_UTF_16_LE, sizeof(BOM_UTF_16_LE), nullptr, nullptr);
-	WriteFile(mhMonitorFile, &BOM_UTF_16_LE, sizeof(BOM_UTF_16_LE), nullptr, nullptr);
+	//   
+	g_hArchiveWakeEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	g_bArchiveRunning = true;
+	g_hArchiveThread = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, archiveThread, nullptr, 0, nullptr));
+
+	// α   (  α״  )
+	mhWriterWakeEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+	mbWriterRunning = true;
+	mhWriterThread = reinterpret_cast<HANDLE>(_beginthreadex(nullptr, 0, writerThread, nullptr, 0, nullptr));
 }
 
 Logger::~Logger()
 {
-	CloseHandle(mhLogFile);
+	// α 带 ߰  α׸   ( α״  )
+	mbWriterRunning = false;
+	SetEvent(mhWriterWakeEvent);
+	WaitForSingleObject(mhWriterThread, INFINITE);
+	CloseHandle(mhWriterThread);
+	CloseHandle(mhWriterWakeEvent);
+
+	Flush();
+
+	CloseHandle(g_logFile.hFile);
+	CloseHandle(g_monitorFile.hFile);
+
+	if (g_binaryLogFile.hFile != nullptr)
+	{
+		CloseHandle(g_binaryLogFile.hFile);
+	}
+
+	// ̹ Ʈ ϵ  ĥ   ٸ (    )
+	g_bArchiveRunning = false;
+	SetEvent(g_hArchiveWakeEvent);
+	WaitForSingleObject(g_hArchiveThread, INFINITE);
+	CloseHandle(g_hArchiveThread);
+	CloseHandle(g_hArchiveWakeEvent);
 }
\ No newline at end of file
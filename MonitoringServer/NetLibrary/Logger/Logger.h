@@ -1,7 +1,10 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 
+#include "LogFormatter.h"
+
 /************************ recommend call this macros instead of Logger::functions ************************/
 
 // ΰ α  Ѵ
@@ -13,8 +16,38 @@
 // α׿ Բ ҽ ϸ  ȣ 
 #define LOG_WITH_LINE(Level, Log)		Logger::LogMessageWithTime((Level), (Log), __FILEW__, __LINE__)
 
-//  α
-#define LOGF(Level, FormatString, ...)	Logger::LogFormatWithTime(Level, FormatString, __VA_ARGS__)
+//  α -  ڿ ȣ ġ  (LogSite) ΰ, ڸ  ״ α  ִ´ (ڿ   α 尡 )
+//  ڿ ȯ ڿ  Ÿ    
+#define LOGF(Level, FormatString, ...) \
+	do \
+	{ \
+		if (Logger::IsLevelEnabled(Level)) \
+		{ \
+			using LogArgKinds_ = decltype(LogArgKindsOf(__VA_ARGS__)); \
+			static_assert(LogFormatter::IsValidFormat<LogArgKinds_>(FormatString), "LOGF format string does not match arguments"); \
+			static constexpr LogSite logSite_ = { Level, FormatString, __FILEW__, __LINE__, LogArgKinds_::Kinds, LogArgKinds_::Count }; \
+			Logger::LogBinary(logSite_, __VA_ARGS__); \
+		} \
+	} while (false)
+
+// LOGF  ȣ ġ ʴ LogsPerSecond   ( ϳϳ   αװ  αװ и ʵ)
+// ģ α״ , α 尡 ȣ ġ "suppressed N similar messages"  ֱ 
+#define LOGF_LIMITED(Level, LogsPerSecond, FormatString, ...) \
+	do \
+	{ \
+		if (Logger::IsLevelEnabled(Level)) \
+		{ \
+			using LogArgKinds_ = decltype(LogArgKindsOf(__VA_ARGS__)); \
+			static_assert(LogFormatter::IsValidFormat<LogArgKinds_>(FormatString), "LOGF format string does not match arguments"); \
+			static_assert((LogsPerSecond) > 0 && (LogsPerSecond) <= 1000000, "LOGF_LIMITED invalid LogsPerSecond"); \
+			static constexpr LogSite logSite_ = { Level, FormatString, __FILEW__, __LINE__, LogArgKinds_::Kinds, LogArgKinds_::Count }; \
+			static LogLimiter logLimiter_ = { &logSite_, (LogsPerSecond) }; \
+			if (Logger::TryAcquireLogToken(logLimiter_)) \
+			{ \
+				Logger::LogBinary(logSite_, __VA_ARGS__); \
+			} \
+		} \
+	} while (false)
 
 // ͸ α (¥ ǥ  α븸 )
 #define LOG_MONITOR(FormatString, ...)	Logger::LogMonitor(FormatString, __VA_ARGS__)
@@ -35,11 +68,53 @@ enum class ELogLevel
 	Assert,		// assertion
 };
 
+// 庰 α   á  
+enum class ELogOverflowPolicy
+{
+	Drop,		// α׸    (αϴ   ٸ )
+	Block,		// α 尡     ٸ
+};
+
 /*********************************************************************************************************/
 
 typedef wchar_t WCHAR;
 typedef void* HANDLE;
 
+// LOGF ȣ ġ ϳ ִ   (ּҰ   ڿ ID)
+struct LogSite
+{
+	ELogLevel			Level;
+	const WCHAR*		Format;
+	const WCHAR*		FileName;
+	int					Line;
+	const ELogArgKind*	ArgKinds;
+	uint32_t			ArgCount;
+};
+
+// LOGF_LIMITED ȣ ġ ϳ ִ ū Ŷ (  ȣ ġ ã  )
+// Ŷ ũ ʴ   LogsPerSecond̸, ´ NextTime ϳ̶ CAS   ū  (GCRA)
+struct LogLimiter
+{
+	const LogSite*		Site;
+	uint32_t			LogsPerSecond;
+	volatile int64_t	NextTime;			// ݱ  α׸ ʴ LogsPerSecond     ð (us, 纸 1 Ѱ ռ ū )
+	volatile long		SuppressedCount;	//     α 
+	volatile long		bListed;			// α   Ͽ ϵ (ó   )
+	LogLimiter*			Next;
+};
+
+////////////////////////////////////////////////
+// α״ α  (庰 SPSC  ) ̰, α  ϳ   Ƽ ܼ / Ͽ   
+// FlushFileBuffers   ƴ϶ SetFlushPolicy() ð / ũ  ȣѴ
+//   α  ,   α״ Ƽ   ȿ    ִ
+// Assert α״   α׸   FlushFileBuffers ģ ڿ ƿ´ (ũ  α  )
+//
+// LOGF ڸ ڵؼ  ֱ⸸ ϹǷ ( ) Ŷ ó ο Debug α׸ ѵξ δ 
+// SetBinaryLog(true) α Ͽ   ä .blog Ͽ , LogDecoder ؽƮ α׷ ٲ  ִ
+//
+// α / ͸ α / ̳ʸ α  α 尡 ڵ ̿ ũ / ¥     Ϸ Ѿ
+//         켱   尡 Ѵ
+////////////////////////////////////////////////
 class Logger
 {
 public:
@@ -47,6 +122,35 @@ public:
 	// ΰ α  Ѵ
 	inline static void SetLogLevel(ELogLevel logLevel) { mLogLevel = logLevel; }
 
+	inline static bool IsLevelEnabled(ELogLevel logLevel) { return mLogLevel <= logLevel; }
+
+	// true  α   .blog (̳ʸ)  (ܼ / ͸ α״ ״ ؽƮ)
+	static void SetBinaryLog(bool bBinaryLog);
+
+	// 庰 α   á   (⺻ Drop)
+	inline static void SetOverflowPolicy(ELogOverflowPolicy policy) { mOverflowPolicy = policy; }
+
+	//  FlushFileBuffers  intervalMs ų bytes ̻ ٸ ٽ FlushFileBuffers ȣѴ
+	inline static void SetFlushPolicy(uint32_t intervalMs, uint32_t bytes) { mFlushIntervalMs = intervalMs; mFlushBytes = bytes; }
+
+	//  maxFileMB ̻ Ǿų (0̸ ũ  ) bDaily̰ ¥ ٲٸ  Ϸ Ѿ (⺻ 64MB, )
+	inline static void SetRotationPolicy(uint32_t maxFileMB, bool bDaily) { mRotateBytes = static_cast<uint64_t>(maxFileMB) * 1024 * 1024; mbRotateDaily = bDaily; }
+
+	// true  Ϸ Ѿ   Ѵ ( ϸ + .xpress, LogDecoder )
+	inline static void SetArchiveCompression(bool bCompression) { mbArchiveCompression = bCompression; }
+
+	// α 丮 α / ͸ α  , days ų ļ maxMB Ѵ ͵  ͺ  (0̸   )
+	static void SetRetentionPolicy(uint32_t days, uint32_t maxMB);
+
+	//     α  (ELogOverflowPolicy::Drop)
+	inline static uint64_t GetDroppedLogCount(void) { return mDroppedLogCount; }
+
+	//   α׸   FlushFileBuffers ģ  ƿ´
+	static void Flush(void);
+
+	// ũ ڵ鷯 Flush - α 尡  ߿ ũð   Ƿ  ٸ Ѵ
+	static void FlushOnCrash(void);
+
 
 	static void LogMonitor(const WCHAR* formatMessage, ...);
 
@@ -57,9 +161,26 @@ public:
 	static void LogFormatWithTime(ELogLevel logLevel, const WCHAR* formatMessage, ...);
 
 	static void LogFormat(ELogLevel logLevel, const WCHAR* formatMessage, ...);
+
+	// LOGF_LIMITED ũο - ū ִٸ ϳ  true, ٸ  α   false
+	static bool TryAcquireLogToken(LogLimiter& limiter);
+
+	// LOGF ũο - ڵ ڵؼ  ִ´ ( ˻ ȣϴ ʿ )
+	template <typename... Ts>
+	static void LogBinary(const LogSite& site, const Ts&... args)
+	{
+		char encodedArgs[LogFormatter::MAX_ARGS_SIZE];
+		uint32_t size = 0;
+
+		int expander[] = { 0, (size = LogFormatter::EncodeArg(encodedArgs, size, args), 0)... };
+		(void)expander;
+
+		writeBinaryLog(site, encodedArgs, size);
+	}
 	 
 	static void LogCurrentTime(void);
 
+	// Assert α״  ġ ʰ  
 	inline static void Assert(bool condition, const WCHAR* message)
 	{
 		if (!condition)
@@ -84,10 +205,53 @@ private:
 	Logger();
 	~Logger();
 
+	//  ڵ  (ڵ ù )
+	enum class ELogTarget : unsigned char
+	{
+		LogFile,		// α Ͽ  ϼ α
+		MonitorFile,	// ͸ α Ͽ  ϼ α
+		BinaryLog,		// LOGF α (α 尡 )
+	};
+
 	static void getCurrentTimeInfo(WCHAR* outBuffer);
 
+	// ϼ α      ִ´ (α 尡 ų bSync ٷ )
+	static void writeLog(ELogTarget target, const WCHAR* log, bool bSync);
+
+	// LOGF α׸    ִ´ (Assert ̰ų α 尡 ٸ ٷ )
+	static void writeBinaryLog(const LogSite& site, const char* encodedArgs, uint32_t size);
+
+	// [header][body] ڵ带    ִ´ (α 尡 ų bSync ٷ )
+	static void writeRecord(const void* header, uint32_t headerSize, const void* body, uint32_t bodySize, bool bSync);
+
+	// ڵ ϳ  ۷ ű (  Ͽ    ¿ ȣ)
+	static void appendRecord(const char* record, uint32_t size);
+
+	// Ʒ  Լ   Ͽ    ¿ ȣѴ (Logger.cpp)
+	//   α׸  ۷ ű (     )
+	static void drainRings(void);
+
+	//  α׸ ܼ / Ͽ , bForceFlush å   FlushFileBuffers ȣ
+	static void writeBatches(bool bForceFlush);
+
+	static unsigned int writerThread(void* param);
+
+	// Ʈ  ϰ   Ѵ (Logger.cpp)
+	static unsigned int archiveThread(void* param);
+
 	static Logger mInstance;
-	static HANDLE mhLogFile;
-	static HANDLE mhMonitorFile;
+	static volatile bool mbBinaryLog;
 	static ELogLevel mLogLevel;
+	static ELogOverflowPolicy mOverflowPolicy;
+	static uint32_t mFlushIntervalMs;
+	static uint32_t mFlushBytes;
+	static uint64_t mRotateBytes;
+	static bool mbRotateDaily;
+	static bool mbArchiveCompression;
+	static uint32_t mRetentionDays;
+	static uint64_t mRetentionBytes;
+	static volatile uint64_t mDroppedLogCount;
+	static HANDLE mhWriterThread;
+	static HANDLE mhWriterWakeEvent;
+	static volatile bool mbWriterRunning;
 };
\ No newline at end of file
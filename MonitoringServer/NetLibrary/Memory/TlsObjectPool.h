@@ -1,5 +1,9 @@
 ///////////////////////////////////////////////////////////////////////////////
 // TLS Ʈ Ǯ
+// ûũ ϳ ĵ  ߶  ( 500 new 500  )
+//  ĳ  迡 ,   Ѹ    ҴѴ
+// ٸ 尡 Ҵ Ʈ Free()ϸ   ݳ   
+// Trim() ѵ   ûũ  ° ִ  OS ش
 ///////////////////////////////////////////////////////////////////////////////
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -11,6 +15,9 @@
 #pragma once
 
 #include <cstdint>
+#include <cstring>
+#include <new>
+#include <vector>
 #include <Windows.h>
 
 #include "ObjectPool.h"
@@ -24,6 +31,76 @@ public:
     inline static uint32_t  GetObjectPerChunkCount(void) { return OBJECT_COUNT_PER_CHUNK; }
     inline static uint32_t  GetTotalChunkCount(void) { return mPoolManager.mChunkTotalCount; }
     inline static uint32_t  GetTotalCreatedObjectCount(void) { return mPoolManager.mChunkTotalCount * OBJECT_COUNT_PER_CHUNK; }
+    inline static uint32_t  GetChunkInManagerCount(void) { return mPoolManager.mChunkInManagerCount; }
+    inline static uint64_t  GetSlabBytes(void) { return mPoolManager.mSlabBytes; }
+    inline static bool      IsLargePageEnabled(void) { return mPoolManager.mbUseLargePage; }
+
+    inline static uint64_t  GetRemoteFreeBatchCount(void) { return mPoolManager.mRemoteFreeBatchCount; }
+    inline static uint64_t  GetReleasedSlabBytes(void) { return mPoolManager.mReleasedSlabBytes; }
+
+    //   TLS Ǯ   (Ҵ ) Ʈ  - ͸̶ mSize   д´
+    static uint32_t GetThreadCachedObjectCount(void)
+    {
+        uint32_t cachedCount = 0;
+
+        ::AcquireSRWLockShared(&mPoolManager.mLock);
+
+        for (uint32_t i = 0; i < mPoolManager.mThreadPoolSlotCount; ++i)
+        {
+            if (mPoolManager.mThreadPoolSlots[i].Pool != nullptr)
+            {
+                cachedCount += mPoolManager.mThreadPoolSlots[i].Pool->mSize;
+            }
+        }
+
+        ::ReleaseSRWLockShared(&mPoolManager.mLock);
+
+        return cachedCount;
+    }
+
+    //  Trim()  Ŵ     ûũ  keepChunkCount  ,
+    //  ȿ 尡  ִ  OS ȯѴ (ȯ Ʈ  )
+    // Ŵ      , 带 ȴ ϰ VirtualFree()  ۿ Ѵ
+    //  尡  Կ ƿ 鵵   ûũ  Ŵ ű
+    static uint64_t Trim(const uint32_t keepChunkCount)
+    {
+        return mPoolManager.Trim(keepChunkCount);
+    }
+
+    //      ҴѴ (SeLockMemoryPrivilege ʿ)
+    //   ϸ false ȯϰ Ϲ   Ѵ
+    static bool EnableLargePage(void)
+    {
+        const SIZE_T largePageSize = ::GetLargePageMinimum();
+        if (largePageSize == 0)
+        {
+            return false;
+        }
+
+        HANDLE token;
+        if (FALSE == ::OpenProcessToken(::GetCurrentProcess(), TOKEN_ADJUST_PRIVILEGES | TOKEN_QUERY, &token))
+        {
+            return false;
+        }
+
+        TOKEN_PRIVILEGES privileges{};
+        privileges.PrivilegeCount = 1;
+        privileges.Privileges[0].Attributes = SE_PRIVILEGE_ENABLED;
+
+        bool bIsEnabled = ::LookupPrivilegeValue(nullptr, SE_LOCK_MEMORY_NAME, &privileges.Privileges[0].Luid)
+            && ::AdjustTokenPrivileges(token, FALSE, &privileges, 0, nullptr, nullptr)
+            && ::GetLastError() == ERROR_SUCCESS;
+
+        ::CloseHandle(token);
+
+        if (bIsEnabled)
+        {
+            mPoolManager.mLargePageSize = largePageSize;
+            mPoolManager.mbUseLargePage = true;
+        }
+
+        return bIsEnabled;
+    }
 
     // ̸ ûũ  ´
     static void PreCreateChunk(uint32_t chunkCount)
@@ -35,15 +112,31 @@ public:
     }
 
 public:
-    TlsObjectPool(bool bNeedPlacementNew = false) { mbNeedPlacementNew = bNeedPlacementNew; }
+    TlsObjectPool(bool bNeedPlacementNew = false)
+    {
+        mbNeedPlacementNew = bNeedPlacementNew;
+        mPoolManager.RegisterThreadPool(this);
+    }
+
+    ~TlsObjectPool(void)
+    {
+        // Ƶδ ٸ  Ʈ ο 
+        for (RemoteFreeBatch& batch : mRemoteFreeBatches)
+        {
+            flushRemoteFreeBatch(batch);
+        }
+
+        //  Ʈ  ݳ ÿ ÷ΰ,   ̾޴  (Ǵ Trim()) 
+        mPoolManager.UnregisterThreadPool(this, mTop);
+    }
 
     inline uint32_t GetSize(void) const { return mSize; }
 
     // Ʈ Ǯκ Ʈ Ҵ޴´
     T* Alloc(void)
     {
-        // ִٸ Ʈ Ǯ Ŵκ Ʈ  ´
-        if (mTop == nullptr)
+        // ִٸ ٸ 尡  Ʈ  , װ͵ ٸ Ʈ Ǯ Ŵκ Ʈ  ´
+        if (mTop == nullptr && false == adoptReturnedNodes())
         {
             mTop = mPoolManager.AllocChunk();
             mSize = OBJECT_COUNT_PER_CHUNK;
@@ -53,6 +146,8 @@ public:
         mTop = mTop->Next;
         --mSize;
 
+        retNode->Owner = mSlotIndex;
+
         if (mbNeedPlacementNew)
         {
             new (&(retNode->Data)) T();
@@ -84,6 +179,15 @@ public:
             address->~T();
         }
 
+        // ٸ 尡 Ҵ Ʈ  忡 
+        // (  Ǯ ׾Ƶθ Ҵ縸 ϴ  Ŵ,  ϴ  Ŵ ûũ  ű )
+        const uint32_t owner = node->Owner;
+        if (owner != mSlotIndex && owner != INVALID_SLOT_INDEX)
+        {
+            pushRemoteFree(node, owner);
+            return;
+        }
+
         node->Next = mTop;
         mTop = node;
         ++mSize;
@@ -104,28 +208,137 @@ public:
 
 private:
 
+    // ̿ 峢 ĳ   ʵ ĳ   
 #if USING_OBJECT_POOL_OPTION == POOL_OPTION_DEBUG_POOL
-    struct Node
+    struct alignas(64) Node
     {
         Node* SafeBlock;
         T Data;
         Node* Next;
+        uint32_t Owner;     // Ҵ   ȣ
+        uint32_t Slab;      //  尡   ȣ
     };
 #else
-    struct Node
+    struct alignas(64) Node
     {
         T Data;
         Node* Next;
+        uint32_t Owner;     // Ҵ   ȣ
+        uint32_t Slab;      //  尡   ȣ
     };
 #endif
 
     enum
     {
         MAX_CHUNK_COUNT = 100'000,
+        MAX_SLAB_COUNT = MAX_CHUNK_COUNT,   //  ûũ ϳ ̻ Ƿ ûũ   ʴ´
+        MAX_THREAD_POOL_COUNT = 256,        //    ִ TLS Ǯ () , Ѿ ݳ   
         OBJECT_COUNT_PER_CHUNK = 500,
         MAX_OBJECT_COUNT_PER_THREAD = OBJECT_COUNT_PER_CHUNK * 2,
+        SLAB_GRANULARITY = 64 * 1024,       // VirtualAlloc Ҵ 
+        MAX_LARGE_PAGE_COUNT_PER_SLAB = 8,  //    ϳ  ִ  
+        LARGE_PAGE_WASTE_DIVISOR = 16,      //    ûũ ä ϴ  ġ (1/16)
+        REMOTE_FREE_BATCH_COUNT = 64,       // ٸ  Ʈ  ŭ Ƽ   CAS 
+        REMOTE_FREE_BATCH_SLOT_COUNT = 8,   // ÿ Ƶ  ִ    ( ȣ )
+    };
+
+    static constexpr uint32_t INVALID_SLOT_INDEX = 0xFFFF'FFFF;
+
+    //  庰  ִ ݳ  (Top Tail Next )
+    struct RemoteFreeBatch
+    {
+        uint32_t Owner = INVALID_SLOT_INDEX;
+        uint32_t Count = 0;
+        Node* Top = nullptr;
+        Node* Tail = nullptr;
+    };
+
+    // 帶 ϳ ޴ , 尡 Ǿ  ݳ  Ŵ ´
+    // ݳ  ٸ    pushϰ,   ° ⸸ ϹǷ ABA  
+    struct alignas(64) ThreadPoolSlot
+    {
+        TlsObjectPool* Pool;            // nullptr̶   
+        Node* volatile ReturnTop;
+    };
+
+    //   (Trim() ° ִ  ã  , Address nullptr̶  ĭ)
+    struct SlabInfo
+    {
+        unsigned char* Address;
+        SIZE_T Bytes;
+        uint32_t NodeCount;
+        uint32_t FreeNodeCount;         // Trim() ߿  (mTrimLock)
     };
 
+private:
+
+    // ٸ  Ʈ  ִ´,   ų ٸ   ĭ ġ 
+    void pushRemoteFree(Node* node, const uint32_t owner)
+    {
+        RemoteFreeBatch& batch = mRemoteFreeBatches[owner % REMOTE_FREE_BATCH_SLOT_COUNT];
+
+        if (batch.Count != 0 && batch.Owner != owner)
+        {
+            flushRemoteFreeBatch(batch);
+        }
+
+        if (batch.Count == 0)
+        {
+            batch.Owner = owner;
+            batch.Tail = node;
+            node->Next = nullptr;
+        }
+        else
+        {
+            node->Next = batch.Top;
+        }
+
+        batch.Top = node;
+        ++batch.Count;
+
+        if (batch.Count == REMOTE_FREE_BATCH_COUNT)
+        {
+            flushRemoteFreeBatch(batch);
+        }
+    }
+
+    void flushRemoteFreeBatch(RemoteFreeBatch& batch)
+    {
+        if (batch.Count == 0)
+        {
+            return;
+        }
+
+        mPoolManager.PushReturnedNodes(batch.Owner, batch.Top, batch.Tail);
+        InterlockedIncrement64(reinterpret_cast<LONG64 volatile*>(&mPoolManager.mRemoteFreeBatchCount));
+
+        batch.Count = 0;
+        batch.Top = nullptr;
+        batch.Tail = nullptr;
+    }
+
+    //   ݳ  °  TLS Ǯ  (  ٸ false)
+    //  ûũ ٸ   ûũ Ŵ ѱ  ûũ ϸ  mSize <= OBJECT_COUNT_PER_CHUNK Ѵ
+    bool adoptReturnedNodes(void)
+    {
+        if (mSlotIndex == INVALID_SLOT_INDEX)
+        {
+            return false;
+        }
+
+        Node* returned = mPoolManager.TakeReturnedNodes(mSlotIndex);
+        if (returned == nullptr)
+        {
+            return false;
+        }
+
+        uint32_t count;
+        mTop = mPoolManager.FreeFullChunks(returned, &count);
+        mSize = count;
+
+        return true;
+    }
+
 private:
 
     // Ǯ  ϳ  ߾ Ǯ 
@@ -133,7 +346,11 @@ private:
     class ObjectPoolManager
     {
     public:
-        ObjectPoolManager(void) { ::InitializeSRWLock(&mLock); }
+        ObjectPoolManager(void)
+        {
+            ::InitializeSRWLock(&mLock);
+            ::InitializeSRWLock(&mTrimLock);
+        }
 
         // ûũ Ҵ޴´
         Node* AllocChunk(void)
@@ -152,25 +369,19 @@ private:
                     ret = mChunks[mChunkInManagerCount];
                 }
 
+                // Trim()   ķ     ûũ    ֵ ġ 
+                if (mChunkInManagerCount < mChunkInManagerLowWater)
+                {
+                    mChunkInManagerLowWater = mChunkInManagerCount;
+                }
+
                 ::ReleaseSRWLockExclusive(&mLock);
             }
 
             if (bIsEmpty)
             {
-                // Ӱ ûũ  ȯѴ
-
-                Node* prevNode = nullptr;
-
-                for (int i = 0; i < OBJECT_COUNT_PER_CHUNK; ++i)
-                {
-                    Node* newNode = new Node;
-                    newNode->Next = prevNode;
-                    prevNode = newNode;
-                }
-
-                ret = prevNode;
-
-                CrashDump::Assert(InterlockedIncrement(&mChunkTotalCount) <= MAX_CHUNK_COUNT);
+                // Ӱ      ûũ ȯѴ
+                ret = createSlab();
             }
 
             return ret;
@@ -187,39 +398,502 @@ private:
             ::ReleaseSRWLockExclusive(&mLock);
         }
 
+        //  Ʈ տ OBJECT_COUNT_PER_CHUNK ߶ Ŵ ѱ,   ûũ ϸ ȯѴ
+        Node* FreeFullChunks(Node* top, uint32_t* outRemainCount)
+        {
+            Node* chunkTop = top;
+            uint32_t count = 0;
+
+            for (Node* node = top; node != nullptr;)
+            {
+                Node* next = node->Next;
+                ++count;
+
+                if (count == OBJECT_COUNT_PER_CHUNK && next != nullptr)
+                {
+                    node->Next = nullptr;
+                    FreeChunk(chunkTop);
+
+                    chunkTop = next;
+                    count = 0;
+                }
+
+                node = next;
+            }
+
+            *outRemainCount = count;
+
+            return chunkTop;
+        }
+
+        //   ݳ ÿ   (top ~ tail) push
+        void PushReturnedNodes(const uint32_t owner, Node* top, Node* tail)
+        {
+            ThreadPoolSlot& slot = mThreadPoolSlots[owner];
+            Node* oldTop;
+
+            do
+            {
+                oldTop = slot.ReturnTop;
+                tail->Next = oldTop;
+            } while (InterlockedCompareExchangePointer(reinterpret_cast<PVOID volatile*>(&slot.ReturnTop), top, oldTop) != oldTop);
+        }
+
+        // ݳ  ° 
+        Node* TakeReturnedNodes(const uint32_t slotIndex)
+        {
+            ThreadPoolSlot& slot = mThreadPoolSlots[slotIndex];
+
+            if (slot.ReturnTop == nullptr)
+            {
+                return nullptr;
+            }
+
+            return reinterpret_cast<Node*>(InterlockedExchangePointer(reinterpret_cast<PVOID volatile*>(&slot.ReturnTop), nullptr));
+        }
+
         // ûũ  Ǯ Ŵ  ´
         void CreateChunk(void)
         {
-            Node* prevNode = nullptr;
+            FreeChunk(createSlab());
+        }
 
-            for (int i = 0; i < OBJECT_COUNT_PER_CHUNK; ++i)
+        //  TLS Ǯ ִ      ش (   )
+        //  ڶ INVALID_SLOT_INDEX ,   Ʈ   Ǯ 
+        void RegisterThreadPool(TlsObjectPool* threadPool)
+        {
+            ::AcquireSRWLockExclusive(&mLock);
+
+            for (uint32_t i = 0; i < MAX_THREAD_POOL_COUNT; ++i)
             {
-                Node* newNode = new Node;
-                newNode->Next = prevNode;
-                prevNode = newNode;
+                if (mThreadPoolSlots[i].Pool == nullptr)
+                {
+                    mThreadPoolSlots[i].Pool = threadPool;
+                    threadPool->mSlotIndex = i;
+
+                    if (i == mThreadPoolSlotCount)
+                    {
+                        ++mThreadPoolSlotCount;
+                    }
+
+                    break;
+                }
             }
 
-            CrashDump::Assert(InterlockedIncrement(&mChunkTotalCount) <= MAX_CHUNK_COUNT);
+            ::ReleaseSRWLockExclusive(&mLock);
+        }
+
+        // 尡  ִ (remainTop)  ݳ ÿ ø  
+        void UnregisterThreadPool(TlsObjectPool* threadPool, Node* remainTop)
+        {
+            const uint32_t slotIndex = threadPool->mSlotIndex;
+            if (slotIndex == INVALID_SLOT_INDEX)
+            {
+                return;
+            }
+
+            if (remainTop != nullptr)
+            {
+                Node* remainTail = remainTop;
+                while (remainTail->Next != nullptr)
+                {
+                    remainTail = remainTail->Next;
+                }
+
+                PushReturnedNodes(slotIndex, remainTop, remainTail);
+            }
 
             ::AcquireSRWLockExclusive(&mLock);
 
-            mChunks[mChunkInManagerCount] = prevNode;
-            ++mChunkInManagerCount;
+            mThreadPoolSlots[slotIndex].Pool = nullptr;
 
             ::ReleaseSRWLockExclusive(&mLock);
         }
 
+        uint64_t Trim(const uint32_t keepChunkCount)
+        {
+            //  FreeNodeCount  ۿ Ƿ Trim() ġ ʰ Ѵ
+            ::AcquireSRWLockExclusive(&mTrimLock);
+
+            std::vector<Node*> idleChunks;
+            uint32_t slabCount;
+
+            {
+                ::AcquireSRWLockExclusive(&mLock);
+
+                collectOrphanSlots();
+
+                //  ٴ  mChunkInManagerLowWater  Trim()      ûũ
+                //   keepChunkCount   
+                const uint32_t idleChunkCount = (mChunkInManagerLowWater < mChunkInManagerCount) ? mChunkInManagerLowWater : mChunkInManagerCount;
+
+                if (idleChunkCount > keepChunkCount)
+                {
+                    const uint32_t detachChunkCount = idleChunkCount - keepChunkCount;
+
+                    idleChunks.assign(mChunks, mChunks + detachChunkCount);
+
+                    mChunkInManagerCount -= detachChunkCount;
+                    ::memmove(mChunks, mChunks + detachChunkCount, sizeof(Node*) * mChunkInManagerCount);
+                }
+
+                mChunkInManagerLowWater = mChunkInManagerCount;
+                slabCount = mSlabCount;
+
+                ::ReleaseSRWLockExclusive(&mLock);
+            }
+
+            uint64_t releasedBytes = 0;
+
+            if (false == idleChunks.empty())
+            {
+                releasedBytes = releaseIdleSlabs(idleChunks, slabCount);
+            }
+
+            ::ReleaseSRWLockExclusive(&mTrimLock);
+
+            return releasedBytes;
+        }
+
+    private:
+
+        //  ϳ Ҵ  ŭ ûũ 
+        // ù ° ûũ ȯϰ  ûũ Ŵ 
+        Node* createSlab(void)
+        {
+            const SIZE_T chunkBytes = sizeof(Node) * OBJECT_COUNT_PER_CHUNK;
+
+            unsigned char* slab = nullptr;
+            SIZE_T slabBytes = 0;
+
+            if (mbUseLargePage)
+            {
+                slabBytes = getLargePageSlabBytes(chunkBytes);
+
+                if (slabBytes != 0)
+                {
+                    slab = static_cast<unsigned char*>(::VirtualAlloc(nullptr, slabBytes, MEM_RESERVE | MEM_COMMIT | MEM_LARGE_PAGES, PAGE_READWRITE));
+                }
+            }
+
+            //    ߴٸ ( ޸ ȭ , Ǵ  ʹ ŭ) Ϲ  Ҵ
+            if (slab == nullptr)
+            {
+                slabBytes = (chunkBytes + SLAB_GRANULARITY - 1) / SLAB_GRANULARITY * SLAB_GRANULARITY;
+                slab = static_cast<unsigned char*>(::VirtualAlloc(nullptr, slabBytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE));
+            }
+
+            CrashDump::Assert(slab != nullptr);
+
+            const uint32_t chunkCount = static_cast<uint32_t>(slabBytes / chunkBytes);
+
+            uint32_t slabIndex;
+
+            {
+                ::AcquireSRWLockExclusive(&mLock);
+
+                mChunkTotalCount += chunkCount;
+                mSlabBytes += slabBytes;
+
+                for (slabIndex = 0; slabIndex < mSlabCount; ++slabIndex)
+                {
+                    if (mSlabs[slabIndex].Address == nullptr)
+                    {
+                        break;
+                    }
+                }
+
+                if (slabIndex == mSlabCount)
+                {
+                    ++mSlabCount;
+                }
+
+                mSlabs[slabIndex] = { slab, slabBytes, chunkCount * OBJECT_COUNT_PER_CHUNK, 0 };
+
+                ::ReleaseSRWLockExclusive(&mLock);
+            }
+
+            CrashDump::Assert(mChunkTotalCount <= MAX_CHUNK_COUNT);
+
+            // ûũ   ּ   (Alloc() ޸𸮸  ȵ)
+            Node* nodes = reinterpret_cast<Node*>(slab);
+            Node* firstChunkTop = nullptr;
+
+            for (uint32_t chunk = 0; chunk < chunkCount; ++chunk)
+            {
+                Node* chunkNodes = nodes + chunk * OBJECT_COUNT_PER_CHUNK;
+                Node* nextNode = nullptr;
+
+                for (int i = OBJECT_COUNT_PER_CHUNK - 1; i >= 0; --i)
+                {
+                    Node* newNode = new (&chunkNodes[i]) Node;
+                    newNode->Next = nextNode;
+                    newNode->Owner = INVALID_SLOT_INDEX;
+                    newNode->Slab = slabIndex;
+                    nextNode = newNode;
+                }
+
+                if (chunk == 0)
+                {
+                    firstChunkTop = nextNode;
+                }
+                else
+                {
+                    FreeChunk(nextNode);
+                }
+            }
+
+            return firstChunkTop;
+        }
+
+        // ûũ ä   1/LARGE_PAGE_WASTE_DIVISOR ϰ Ǵ       ũ⸦ Ѵ
+        // ( : 4MB  ûũ 2MB   øϸ ִ 2MB    )
+        //  MAX_LARGE_PAGE_COUNT_PER_SLAB ׷ ũⰡ ٸ 0 ȯ (Ϲ  Ҵ)
+        SIZE_T getLargePageSlabBytes(const SIZE_T chunkBytes) const
+        {
+            for (uint64_t pageCount = 1; pageCount <= MAX_LARGE_PAGE_COUNT_PER_SLAB; ++pageCount)
+            {
+                const uint64_t slabBytes = pageCount * mLargePageSize;
+                const uint64_t chunkCount = slabBytes / chunkBytes;
+
+                if (chunkCount == 0)
+                {
+                    continue;
+                }
+
+                const uint64_t wasteBytes = slabBytes - chunkCount * chunkBytes;
+
+                if (wasteBytes * LARGE_PAGE_WASTE_DIVISOR <= slabBytes)
+                {
+                    return static_cast<SIZE_T>(slabBytes);
+                }
+            }
+
+            return 0;
+        }
+
+        //   Կ ƿ    ûũ  Ŵ ű (mLock  · ȣ)
+        //  ûũ  ʴ  Կ ٽ ÷д
+        void collectOrphanSlots(void)
+        {
+            for (uint32_t i = 0; i < mThreadPoolSlotCount; ++i)
+            {
+                if (mThreadPoolSlots[i].Pool != nullptr)
+                {
+                    continue;
+                }
+
+                Node* returned = TakeReturnedNodes(i);
+                if (returned == nullptr)
+                {
+                    continue;
+                }
+
+                Node* chunkTop = returned;
+                Node* tail = nullptr;
+                uint32_t count = 0;
+
+                for (Node* node = returned; node != nullptr;)
+                {
+                    Node* next = node->Next;
+                    ++count;
+
+                    if (count == OBJECT_COUNT_PER_CHUNK)
+                    {
+                        node->Next = nullptr;
+
+                        mChunks[mChunkInManagerCount] = chunkTop;
+                        ++mChunkInManagerCount;
+
+                        chunkTop = next;
+                        count = 0;
+                    }
+                    else
+                    {
+                        tail = node;
+                    }
+
+                    node = next;
+                }
+
+                if (count != 0)
+                {
+                    PushReturnedNodes(i, chunkTop, tail);
+                }
+            }
+        }
+
+        //  ûũ(chunks) 尡  ִ  OS ȯϰ,   ٽ ûũ  Ŵ ٴڿ ´
+        //    常  Ƿ ȴ ϰ VirtualFree()   Ѵ (mTrimLock  · ȣ)
+        // slabCount   mSlabCount -  ڿ    chunks 
+        uint64_t releaseIdleSlabs(std::vector<Node*>& chunks, const uint32_t slabCount)
+        {
+            const uint32_t oldChunkCount = static_cast<uint32_t>(chunks.size());
+
+            //    
+            for (Node* chunkTop : chunks)
+            {
+                for (Node* node = chunkTop; node != nullptr; node = node->Next)
+                {
+                    ++mSlabs[node->Slab].FreeNodeCount;
+                }
+            }
+
+            // ȯ  FreeNodeCount == NodeCount ܵΰ,  0 ǵ
+            uint32_t releaseChunkCount = 0;
+
+            for (uint32_t i = 0; i < slabCount; ++i)
+            {
+                SlabInfo& slab = mSlabs[i];
+
+                if (slab.FreeNodeCount == 0)
+                {
+                    continue;
+                }
+
+                if (slab.FreeNodeCount == slab.NodeCount)
+                {
+                    releaseChunkCount += slab.NodeCount / OBJECT_COUNT_PER_CHUNK;
+                }
+                else
+                {
+                    slab.FreeNodeCount = 0;
+                }
+            }
+
+            // ȯ  带  ûũ ٽ  ( ûũ ȣ а ִ ûũ ȣ  )
+            uint32_t newChunkCount = oldChunkCount;
+
+            if (releaseChunkCount > 0)
+            {
+                newChunkCount = 0;
+
+                Node* buildTop = nullptr;
+                Node* buildTail = nullptr;
+                uint32_t buildCount = 0;
+
+                for (uint32_t i = 0; i < oldChunkCount; ++i)
+                {
+                    for (Node* node = chunks[i]; node != nullptr;)
+                    {
+                        Node* next = node->Next;
+                        const SlabInfo& slab = mSlabs[node->Slab];
+
+                        if (slab.FreeNodeCount != slab.NodeCount)
+                        {
+                            node->Next = nullptr;
+
+                            if (buildTop == nullptr)
+                            {
+                                buildTop = node;
+                            }
+                            else
+                            {
+                                buildTail->Next = node;
+                            }
+
+                            buildTail = node;
+                            ++buildCount;
+
+                            if (buildCount == OBJECT_COUNT_PER_CHUNK)
+                            {
+                                chunks[newChunkCount] = buildTop;
+                                ++newChunkCount;
+
+                                buildTop = nullptr;
+                                buildCount = 0;
+                            }
+                        }
+
+                        node = next;
+                    }
+                }
+
+                CrashDump::Assert(buildCount == 0 && newChunkCount + releaseChunkCount == oldChunkCount);
+            }
+
+            //  ȯ - 尡   ʿ Ƿ ٸ 尡 ǵ帮 ʴ´
+            uint64_t releasedBytes = 0;
+
+            for (uint32_t i = 0; i < slabCount && releaseChunkCount > 0; ++i)
+            {
+                SlabInfo& slab = mSlabs[i];
+
+                if (slab.FreeNodeCount == 0 || slab.FreeNodeCount != slab.NodeCount)
+                {
+                    continue;
+                }
+
+                // Alloc()/Free() /Ҹڸ θ ʴ Ǯ̶ Ʈ ִ · Ǿ 
+                if (false == mbNeedPlacementNew)
+                {
+                    Node* nodes = reinterpret_cast<Node*>(slab.Address);
+
+                    for (uint32_t n = 0; n < slab.NodeCount; ++n)
+                    {
+                        nodes[n].Data.~T();
+                    }
+                }
+
+                ::VirtualFree(slab.Address, 0, MEM_RELEASE);
+
+                releasedBytes += slab.Bytes;
+            }
+
+            //  ûũ  ٴڿ  ( Trim()   ûũ ̵), ȯ  ĭ 
+            {
+                ::AcquireSRWLockExclusive(&mLock);
+
+                ::memmove(mChunks + newChunkCount, mChunks, sizeof(Node*) * mChunkInManagerCount);
+                ::memcpy(mChunks, chunks.data(), sizeof(Node*) * newChunkCount);
+
+                mChunkInManagerCount += newChunkCount;
+                mChunkInManagerLowWater += newChunkCount;
+
+                for (uint32_t i = 0; i < slabCount && releaseChunkCount > 0; ++i)
+                {
+                    SlabInfo& slab = mSlabs[i];
+
+                    if (slab.FreeNodeCount != 0 && slab.FreeNodeCount == slab.NodeCount)
+                    {
+                        slab = {};
+                    }
+                }
+
+                mChunkTotalCount -= releaseChunkCount;
+                mSlabBytes -= releasedBytes;
+                mReleasedSlabBytes += releasedBytes;
+
+                ::ReleaseSRWLockExclusive(&mLock);
+            }
+
+            return releasedBytes;
+        }
+
     public:
         SRWLOCK mLock;
+        SRWLOCK mTrimLock;                     // Trim() ȭ (mLock ûũ    ´)
         Node* mChunks[MAX_CHUNK_COUNT]{};
         uint32_t mChunkInManagerCount = 0;
+        uint32_t mChunkInManagerLowWater = 0;  //  Trim()  mChunkInManagerCount ġ
         uint32_t mChunkTotalCount = 0;
+        uint64_t mSlabBytes = 0;
+        uint64_t mReleasedSlabBytes = 0;
+        bool mbUseLargePage = false;
+        SIZE_T mLargePageSize = 0;
+        SlabInfo mSlabs[MAX_SLAB_COUNT]{};
+        uint32_t mSlabCount = 0;
+        ThreadPoolSlot mThreadPoolSlots[MAX_THREAD_POOL_COUNT]{};
+        uint32_t mThreadPoolSlotCount = 0;     //  ̶   
+        uint64_t mRemoteFreeBatchCount = 0;    //  忡   
     };
 
 private:
     Node* mTop = nullptr;
     Node* mHalfTop = nullptr; // OBJECT_COUNT_PER_CHUNK + 1 ° 带 Ų
     uint32_t mSize = 0;
+    uint32_t mSlotIndex = INVALID_SLOT_INDEX;
+    RemoteFreeBatch mRemoteFreeBatches[REMOTE_FREE_BATCH_SLOT_COUNT];
 
     inline static bool mbNeedPlacementNew;  // Alloc()/Free()ȣ , /Ҹڸ ȣ    ɼ
     inline static ObjectPoolManager mPoolManager;
@@ -115,9 +115,7 @@ unsigned int NetClient::recvThread(void* netClient)
             }
 
             // 3. packet copy
-            Serializer* packet = Serializer::l_packetPool.Alloc();
-            packet->IncrementRefCount();
-            packet->Clear();
+            Serializer* packet = Serializer::Alloc(header.Length);
 
             bool retDequeue = client->mRecvBuffer.Dequeue(packet->GetFullBufferPointer(), header.Length + sizeof(NetworkHeader));
             ASSERT_LIVE(retDequeue == true, L"client RecvBuffer Dequeue() Error");
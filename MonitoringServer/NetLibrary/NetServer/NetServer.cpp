@@ -26,39 +26,86 @@ void NetServer::Start(const uint16_t port, const uint32_t maxSessionCount, const
 
 	mPort = port;
 	mMaxSessionCount = maxSessionCount;
-	mThreadCount = iocpWorkerThreadCount + 2;
+
+	if (mAcceptThreadCount == 0)
+	{
+		mAcceptThreadCount = 1;
+	}
+
+	mThreadCount = mAcceptThreadCount + iocpWorkerThreadCount + 1;
 
 	if (mMaxPayloadLength == 0)
 	{
 		mMaxPayloadLength = UINT16_MAX;
 	}
 
+	if (mCompletionBatchCount == 0)
+	{
+		mCompletionBatchCount = 1;
+	}
+
+	if (mSendQueueHighWater == 0)
+	{
+		mSendQueueHighWater = DEFAULT_SEND_QUEUE_HIGH_WATER;
+	}
+
 	::timeBeginPeriod(1);
 
+	::QueryPerformanceFrequency(&mPerformanceFrequency);
+
 	NetUtils::WSAStartup();
 
 	mIOCP = NetUtils::CreateNewIOCP(iocpConcurrentThreadCount);
 
+	if (mbIsSkipCompletionPortOnSuccess && false == NetUtils::IsTcpProviderIfs())
+	{
+		LOGF(ELogLevel::System, L"non-IFS TCP provider installed - FILE_SKIP_COMPLETION_PORT_ON_SUCCESS disabled");
+		mbIsSkipCompletionPortOnSuccess = false;
+	}
+
 	// Create Sessions
 	mSessionList = new Session[mMaxSessionCount];
 
 	for (uint32_t i = 0; i < mMaxSessionCount; ++i)
 	{
 		mSessionList[i].bDisconnected = true;
+		mSessionList[i].SendQueue.Init(mSendQueueHighWater);
+		mSessionList[i].SendSlab = mSendSlabSize > 0 ? new char[mSendSlabSize] : nullptr;
+		mSessionList[i].SendSlabSize = mSendSlabSize;
 		mUnusedSessionKeys.Push(i);
 	}
 
+	if (mIdleTimeout > 0)
+	{
+		mIdleTimers.Init(mMaxSessionCount, IDLE_TIMER_TICK_MS);
+	}
+
+	//    Accept 尡 ϹǷ     д
+	// create socket
+	mListenSocket = NetUtils::CreateSocket();
+
+	// bind
+	NetUtils::BindSocket(mListenSocket, mPort);
+
+	// listen
+	NetUtils::SetSocketListen(mListenSocket);
+
+	LOGF(ELogLevel::System, L"Accept Start (Port = %d, Accept Thread Count = %u)", mPort, mAcceptThreadCount);
+
 	// Create threads
 	mThreads = new HANDLE[mThreadCount];
 
-	// AcceptThread
-	mThreads[0] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, acceptThread, this, 0, nullptr));
+	// AcceptThreads
+	for (uint32_t i = 0; i < mAcceptThreadCount; ++i)
+	{
+		mThreads[i] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, acceptThread, this, 0, nullptr));
+	}
 
 	// MonitorThread
-	mThreads[1] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, monitorThread, this, 0, nullptr));
+	mThreads[mAcceptThreadCount] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, monitorThread, this, 0, nullptr));
 
 	// IOCP WorkerThreads
-	for (uint32_t i = 2; i < mThreadCount; ++i)
+	for (uint32_t i = mAcceptThreadCount + 1; i < mThreadCount; ++i)
 	{
 		mThreads[i] = reinterpret_cast<HANDLE>(::_beginthreadex(nullptr, 0, iocpWorkerThread, this, 0, nullptr));
 	}
@@ -72,11 +119,11 @@ void NetServer::Shutdown(void)
 
 	mbIsRunning = false;
 
-	// accept thread
+	// accept threads
 	::closesocket(mListenSocket);
 
 	// IOCP worker threads
-	for (uint32_t i = 0; i < mThreadCount - 2; ++i)
+	for (uint32_t i = 0; i < mThreadCount - mAcceptThreadCount - 1; ++i)
 	{
 		::PostQueuedCompletionStatus(mIOCP, 0, 0, 0);
 	}
@@ -101,10 +148,19 @@ void NetServer::Shutdown(void)
 
 	mbIsTcpNodelay = false;
 	mbIsSendBufferSizeZero = false;
+	mbIsSkipCompletionPortOnSuccess = false;
 	mSessionAcceptedCount = 0;
 	mSessionDisconnectedCount = 0;
 	mPort = 0;
 	mMaxPayloadLength = 0;
+	mCompletionBatchCount = 0;
+	mAcceptThreadCount = 0;
+	mSendQueueHighWater = 0;
+	mSendSlabSize = 0;
+	mPacketPoolTrimSeconds = 0;
+	mPacketPoolKeepChunkCount = 0;
+	mIdleTimeout = 0;
+	mbIsDisconnectOnSendQueueFull = false;
 	mSessionCount = 0;
 	mMaxSessionCount = 0;
 	mThreadCount = 0;
@@ -144,13 +200,58 @@ void NetServer::SendPacket(const uint64_t sessionID, Serializer* packet)
 
 	packet->IncrementRefCount();
 
-	session->SendQueue.Enqueue(packet);
-
-	session->PostSend();
+	if (enqueueSendPacket(session, packet))
+	{
+		session->PostSend();
+	}
 
 	session->DecrementIoCount();
 }
 
+void NetServer::SendPacketMulti(const uint64_t* sessionIDs, const uint32_t sessionCount, Serializer* packet)
+{
+	if (packet == nullptr || sessionCount == 0)
+	{
+		return;
+	}
+
+	if (!packet->IsSendPrepared())
+	{
+		packet->prepareSend();
+	}
+
+	// Ǹ  īƮ ø ʰ   ø ,     
+	packet->IncrementRefCount(sessionCount);
+
+	for (uint32_t i = 0; i < sessionCount; ++i)
+	{
+		const uint64_t sessionID = sessionIDs[i];
+
+		Session* session = findSessionOrNull(sessionID);
+		if (session == nullptr)
+		{
+			packet->DecrementRefCount();
+			continue;
+		}
+
+		int32_t retIoCount = static_cast<int32_t>(session->IncrementIoCount());
+
+		if (retIoCount < 0 || session->bDisconnected || session->bDisconnectRegistered || session->ID != sessionID)
+		{
+			session->DecrementIoCount();
+			packet->DecrementRefCount();
+			continue;
+		}
+
+		if (enqueueSendPacket(session, packet))
+		{
+			requestSend(session);
+		}
+
+		session->DecrementIoCount();
+	}
+}
+
 void NetServer::Disconnect(const uint64_t sessionID)
 {
 	Session* session = findSessionOrNull(sessionID);
@@ -207,9 +308,10 @@ void NetServer::SendAndDisconnect(const uint64_t sessionID, Serializer* packet)
 
 	packet->IncrementRefCount();
 
-	session->SendQueue.Enqueue(packet);
-
-	session->PostSend();
+	if (enqueueSendPacket(session, packet))
+	{
+		session->PostSend();
+	}
 
 	session->DecrementIoCount();
 }
@@ -239,29 +341,42 @@ bool NetServer::GetSessionAddress(const uint64_t sessionID, SOCKADDR_IN* outAddr
 	return true;
 }
 
-unsigned int NetServer::acceptThread(void* netServerParam)
+bool NetServer::GetSendQueueCount(const uint64_t sessionID, uint32_t* outCount) const
 {
-	LOGF(ELogLevel::System, L"Accept Thread Start (ID : %d)", ::GetCurrentThreadId());
+	ASSERT_LIVE(outCount != nullptr, L"GetSendQueueCount() nullptr passed");
 
-	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
+	Session* session = findSessionOrNull(sessionID);
+	if (session == nullptr)
+	{
+		return false;
+	}
 
-	// create socket
-	netServer->mListenSocket = NetUtils::CreateSocket();
+	int32_t retIoCount = static_cast<int32_t>(session->IncrementIoCount());
 
-	// bind
-	NetUtils::BindSocket(netServer->mListenSocket, netServer->mPort);
+	if (retIoCount < 0 || session->bDisconnected || session->bDisconnectRegistered || session->ID != sessionID)
+	{
+		session->DecrementIoCount();
+		return false;
+	}
 
-	// listen
-	NetUtils::SetSocketListen(netServer->mListenSocket);
+	*outCount = session->SendQueue.GetCount();
+
+	session->DecrementIoCount();
+
+	return true;
+}
 
-	/************************* Server Listening Start *************************/
+unsigned int NetServer::acceptThread(void* netServerParam)
+{
+	LOGF(ELogLevel::System, L"Accept Thread Start (ID : %d)", ::GetCurrentThreadId());
 
-	LOGF(ELogLevel::System, L"Accept Start (Port = %d)", netServer->mPort);
+	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
 
 	SOCKADDR_IN clientAddress{};	// Ŭ̾Ʈ ּ
 	uint32_t newSessionKey;			// ο  Key (  ü )
 	uint64_t newSessionID;			// ο  ID
 	Session* newSession;			// ο  ü
+	LARGE_INTEGER acceptedTick;		// accept()   (Accept ó ð )
 
 	while (netServer->mbIsRunning)
 	{
@@ -273,7 +388,8 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 		{
 			int errorCode = ::WSAGetLastError();
 
-			bool bThreadExit = errorCode == WSAEINTR && netServer->mbIsRunning == false;
+			//    accept() ϴ  WSAEINTR, ʰ   WSAENOTSOCK  ޴´
+			bool bThreadExit = netServer->mbIsRunning == false;
 			if (bThreadExit)
 			{
 				break;
@@ -283,6 +399,8 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 			CrashDump::Crash();
 		}
 
+		::QueryPerformanceCounter(&acceptedTick);
+
 		// socket option
 		NetUtils::SetLinger(clientSocket, 1, 0);
 
@@ -308,7 +426,7 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 		}
 
 		// ο  ID 
-		newSessionID = (++(netServer->mSessionAcceptedCount) & (0x0000'0000'FFFF'FFFFULL)) | (static_cast<uint64_t>(newSessionKey) << 32);
+		newSessionID = (InterlockedIncrement(&netServer->mSessionAcceptedCount) & (0x0000'0000'FFFF'FFFFULL)) | (static_cast<uint64_t>(newSessionKey) << 32);
 
 		//  
 		newSession = &netServer->mSessionList[newSessionKey];
@@ -320,6 +438,16 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 
 			NetUtils::RegisterIOCP(clientSocket, netServer->mIOCP, reinterpret_cast<ULONG_PTR>(newSession));
 
+			//  Ϸ     ǹǷ    Ĵ Ѵ
+			newSession->bSkipCompletionPort = netServer->mbIsSkipCompletionPortOnSuccess && NetUtils::SetSkipCompletionPortOnSuccess(clientSocket);
+
+			//   Ű ɷִ   Ÿ̸Ӵ 
+			if (netServer->mIdleTimeout > 0)
+			{
+				newSession->LastRecvTick = ::timeGetTime();
+				netServer->mIdleTimers.Schedule(newSessionID, netServer->mIdleTimeout);
+			}
+
 			// accept log
 			//LOGF(ELogLevel::Debug, L"Accept - %s:%d", NetUtils::GetIpAddress(newSession->Address).c_str(), NetUtils::GetPortNumber(newSession->Address));
 
@@ -328,12 +456,14 @@ unsigned int NetServer::acceptThread(void* netServerParam)
 
 			netServer->OnAccept(newSession->ID);
 
-			netServer->mMonitoringVariables.AcceptTPS++;
+			InterlockedIncrement(&netServer->mMonitoringVariables.AcceptTPS);
 
 			newSession->PostRecv();
 
 			newSession->DecrementIoCount();
 		}
+
+		netServer->updateAcceptLatency(acceptedTick);
 	}
 
 	LOGF(ELogLevel::System, L"Accept Thread End (ID : %d)", ::GetCurrentThreadId());
@@ -347,174 +477,90 @@ unsigned int NetServer::iocpWorkerThread(void* netServerParam)
 
 	NetServer* netServer = reinterpret_cast<NetServer*>(netServerParam);
 
-	bool retGQCS;
-	NetworkHeader header{};
+	const uint32_t batchCount = netServer->mCompletionBatchCount;
+	OVERLAPPED_ENTRY* entries = new OVERLAPPED_ENTRY[batchCount];
 
-	while (netServer->mbIsRunning)
+	bool bThreadExit = false;
+
+	while (false == bThreadExit)
 	{
-		DWORD transferredBytes = 0;
-		Session* session = 0;
-		OVERLAPPED* overlapped = 0;
+		ULONG removedCount = 0;
 
-		retGQCS = ::GetQueuedCompletionStatus(netServer->mIOCP, &transferredBytes, reinterpret_cast<ULONG_PTR*>(&session), &overlapped, INFINITE);
+		//   ȣ ִ batchCount Ϸ  ´
+		BOOL retGQCSEx = ::GetQueuedCompletionStatusEx(netServer->mIOCP, entries, batchCount, &removedCount, INFINITE, FALSE);
 
-		if (retGQCS) // GQCS return TRUE
+		if (retGQCSEx == FALSE)
 		{
-			if (transferredBytes == 0 && overlapped == 0)
-			{
-				if (session == 0)
-				{
-					//   -  Ż
-					break;
-				}
-				else
-				{
-					// OnRelease û PQCS ó
-					netServer->OnRelease(reinterpret_cast<const uint64_t>(session));
-					continue;
-				}
-			}
-		}
-		else// GQCS return FALSE
-		{
-			int errorCode = ::GetLastError();
-
-			switch (errorCode)
-			{
-			case ERROR_SEM_TIMEOUT:
-			{
-				LOGF(ELogLevel::Debug, L"GQCS FALSE, GetLastError() = %d (SEM_TIMEOUT) -> disconnect", errorCode, ::WSAGetLastError());
-			}
-			break;
-			case ERROR_NETNAME_DELETED:
-			case ERROR_CONNECTION_ABORTED:
-			case ERROR_OPERATION_ABORTED:
-			{
-				ASSERT_LIVE(session != nullptr, L"retGQCS FALSE, but Session is nullptr");
-			}
-			break;
-			default:
-			{
-				LOGF(ELogLevel::Error, L"GQCS FALSE, GetLastError() = %d, WSAGetLastError() = %d", errorCode, ::WSAGetLastError());
-				CrashDump::Crash();
-			}
-			break;
-			}
-
-			//   ó
-
-			goto DECREMENT_IO_COUNT;
+			LOGF(ELogLevel::Error, L"GQCSEx FALSE, GetLastError() = %d", ::GetLastError());
+			CrashDump::Crash();
 		}
 
-		// Process Disconnect & Send & Recv
-		if (overlapped == &session->SendOverlapped)
-		{
-			// release registered packets
-			uint32_t registeredPacketsCount = session->RegisteredPacketCount;
-			session->RegisteredPacketCount = 0;
-
-			InterlockedAdd64(reinterpret_cast<LONG64*>(&netServer->mMonitoringVariables.SendMessageTPS), registeredPacketsCount);
+		// ͸ īʹ ġ  Ƽ   ݿѴ
+		uint32_t recvMessageCount = 0;
+		uint32_t sendMessageCount = 0;
 
-			for (uint32_t i = 0; i < registeredPacketsCount; ++i)
-			{
-				session->RegisteredPackets[i]->DecrementRefCount();
-			}
-
-			if (session->bDisconnectRegistered)
-			{
-				goto DECREMENT_IO_COUNT;
-			}
-
-			ASSERT_LIVE(InterlockedExchange(&session->bSendFlag, 0) == 1, L"more than 1 Send Error");
-
-			session->PostSend();
-		}
-		else if (overlapped == &session->RecvOverlapped)
+		for (ULONG i = 0; i < removedCount; ++i)
 		{
-			session->RecvBuffer.MoveRear(transferredBytes);
-
-			//  
-			if (transferredBytes == 0 || session->bDisconnectRegistered)
-			{
-				goto DECREMENT_IO_COUNT;
-			}
+			Session* session = reinterpret_cast<Session*>(entries[i].lpCompletionKey);
+			OVERLAPPED* overlapped = entries[i].lpOverlapped;
+			DWORD transferredBytes = entries[i].dwNumberOfBytesTransferred;
 
-			// packet loop
-			while (true)
+			if (transferredBytes == 0 && overlapped == 0)
 			{
-				// 1. header check
-				if (session->RecvBuffer.GetUseSize() < sizeof(NetworkHeader))
+				if (session == 0)
 				{
-					break;
-				}
-
-				bool retPeek = session->RecvBuffer.Peek(reinterpret_cast<char*>(&header), sizeof(header));
-				ASSERT_LIVE(retPeek == true, L"RecvBuffer Peek() Error");
+					//   -  ġ  û   Դٸ ٸ Ŀ  ٽ ־ش
+					if (bThreadExit)
+					{
+						::PostQueuedCompletionStatus(netServer->mIOCP, 0, 0, 0);
+					}
 
-#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
-				// NetServer - code check
-				if (header.Code != NETWORK_HEADER_CODE)
-				{
-					goto DECREMENT_IO_COUNT;
+					bThreadExit = true;
 				}
-#endif
-
-				// 2. header Length check
-				if (header.Length > netServer->GetMaxPayloadLength())
+				else
 				{
-					goto DECREMENT_IO_COUNT;
-				}
+					// OnRelease û PQCS ó
+					const uint64_t releasedSessionID = reinterpret_cast<const uint64_t>(session);
 
-				// 3. payload check
-				if (session->RecvBuffer.GetUseSize() < sizeof(NetworkHeader) + header.Length)
-				{
-					if (session->RecvBuffer.GetFreeSize() <= 0)
+					if (netServer->mIdleTimeout > 0)
 					{
-						goto DECREMENT_IO_COUNT;
+						netServer->mIdleTimers.Cancel(releasedSessionID);
 					}
 
-					break;
+					netServer->OnRelease(releasedSessionID);
 				}
 
-				// 4. packet copy
-				Serializer* packet = Serializer::l_packetPool.Alloc();
-				packet->IncrementRefCount();
-				packet->Clear();
+				continue;
+			}
 
-				bool retDequeue = session->RecvBuffer.Dequeue(packet->GetFullBufferPointer(), header.Length + sizeof(NetworkHeader));
-				ASSERT_LIVE(retDequeue == true, L"RecvBuffer Dequeue() Error");
-				packet->SetUseSize(header.Length);
+			//  I/O Ȯ (GQCS FALSE ȯ  GetLastError()  )
+			DWORD errorCode = 0;
 
-#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
-				// NetServer - decode packet
-				if (false == packet->decode())
+			if (overlapped->Internal != 0)
+			{
+				DWORD bytes;
+				if (FALSE == ::GetOverlappedResult(reinterpret_cast<HANDLE>(session->Socket), overlapped, &bytes, FALSE))
 				{
-					packet->DecrementRefCount();
-					goto DECREMENT_IO_COUNT;
+					errorCode = ::GetLastError();
 				}
-#endif
-
-				// 5. OnReceive()
-				netServer->OnReceive(session->ID, packet);
-
-				InterlockedIncrement(&netServer->mMonitoringVariables.RecvMessageTPS);
 			}
 
-			// Post Recv
-			session->PostRecv();
+			netServer->processCompletion(session, overlapped, transferredBytes, errorCode, &recvMessageCount, &sendMessageCount);
 		}
-		else
+
+		if (recvMessageCount > 0)
 		{
-			ASSERT_LIVE(false, L"Invalid OVERLAPPED");
+			InterlockedAdd(reinterpret_cast<LONG*>(&netServer->mMonitoringVariables.RecvMessageTPS), recvMessageCount);
 		}
 
-
-	DECREMENT_IO_COUNT:
-
-		// ̹    IoCount 1 ν    ϴ ڵ
-		session->DecrementIoCount();
+		if (sendMessageCount > 0)
+		{
+			InterlockedAdd(reinterpret_cast<LONG*>(&netServer->mMonitoringVariables.SendMessageTPS), sendMessageCount);
+		}
 	}
 
+	delete[] entries;
+
 	LOGF(ELogLevel::System, L"IOCP Worker Thread End (ID : %d)", ::GetCurrentThreadId());
 
 	return 0;
@@ -536,10 +582,49 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 
 	uint64_t sumCount = 0;
 
+	uint32_t secondsSinceTrim = 0;
+
 	while (netServer->mbIsRunning)
 	{
 		::Sleep(1'000);
 
+		// Ŷ Ǯ  (ϰ   ׿ִ ûũ OS ȯ)
+		if (netServer->mPacketPoolTrimSeconds != 0 && ++secondsSinceTrim >= netServer->mPacketPoolTrimSeconds)
+		{
+			secondsSinceTrim = 0;
+
+			const uint64_t releasedBytes = Serializer::TrimPool(netServer->mPacketPoolKeepChunkCount);
+			if (releasedBytes != 0)
+			{
+				LOGF(ELogLevel::System, L"Packet Pool Trimmed (%llu KB released)", releasedBytes / 1024);
+			}
+		}
+
+		//  ŸӾƿ -  Ÿ̸ Ǹ ȮѴ
+		if (netServer->mIdleTimeout > 0)
+		{
+			netServer->mIdleTimers.Advance([netServer](const uint64_t sessionID)
+				{
+					Session* session = netServer->findSessionOrNull(sessionID);
+
+					if (session == nullptr || session->ID != sessionID)
+					{
+						return;
+					}
+
+					const DWORD idleTime = ::timeGetTime() - session->LastRecvTick;
+
+					if (idleTime < netServer->mIdleTimeout)
+					{
+						netServer->mIdleTimers.Reschedule(sessionID, netServer->mIdleTimeout - idleTime);
+						return;
+					}
+
+					netServer->Disconnect(sessionID);
+					LOGF(ELogLevel::System, L"sessionID = %llu idle timeout (%u ms)", sessionID, idleTime);
+				});
+		}
+
 		// CPU 
 		cpuTime.UpdateCpuTime();
 		netServer->mMonitorResult.ProcessorTimeTotal = cpuTime.GetProcessorTimeTotal();
@@ -555,6 +640,17 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 		netServer->mMonitorResult.SendMessageTPS = netServer->mMonitoringVariables.SendMessageTPS;
 		netServer->mMonitorResult.RecvPendingTPS = netServer->mMonitoringVariables.RecvPendingTPS;
 		netServer->mMonitorResult.SendPendingTPS = netServer->mMonitoringVariables.SendPendingTPS;
+		netServer->mMonitorResult.RecvInlineTPS = netServer->mMonitoringVariables.RecvInlineTPS;
+		netServer->mMonitorResult.SendInlineTPS = netServer->mMonitoringVariables.SendInlineTPS;
+		netServer->mMonitorResult.SendDropTPS = netServer->mMonitoringVariables.SendDropTPS;
+		netServer->mMonitorResult.SendCallTPS = netServer->mMonitoringVariables.SendCallTPS;
+		netServer->mMonitorResult.SendBytesTPS = netServer->mMonitoringVariables.SendBytesTPS;
+		netServer->mMonitorResult.SendCoalescedTPS = netServer->mMonitoringVariables.SendCoalescedTPS;
+		netServer->mMonitorResult.SendGatherTPS = netServer->mMonitoringVariables.SendGatherTPS;
+		netServer->mMonitorResult.BytesPerSend = netServer->mMonitorResult.SendCallTPS == 0 ? 0 : netServer->mMonitorResult.SendBytesTPS / netServer->mMonitorResult.SendCallTPS;
+		netServer->mMonitorResult.AcceptLatencySumUs = netServer->mMonitoringVariables.AcceptLatencySumUs;
+		netServer->mMonitorResult.AcceptLatencyMaxUs = netServer->mMonitoringVariables.AcceptLatencyMaxUs;
+		netServer->mMonitorResult.AcceptLatencyAvgUs = netServer->mMonitorResult.AcceptTPS == 0 ? 0 : static_cast<uint32_t>(netServer->mMonitorResult.AcceptLatencySumUs / netServer->mMonitorResult.AcceptTPS);
 
 		// Avg TPS
 		sumAcceptTPS += netServer->mMonitorResult.AcceptTPS;
@@ -576,6 +672,15 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 		netServer->mMonitoringVariables.SendMessageTPS = 0;
 		netServer->mMonitoringVariables.RecvPendingTPS = 0;
 		netServer->mMonitoringVariables.SendPendingTPS = 0;
+		netServer->mMonitoringVariables.RecvInlineTPS = 0;
+		netServer->mMonitoringVariables.SendInlineTPS = 0;
+		netServer->mMonitoringVariables.SendDropTPS = 0;
+		netServer->mMonitoringVariables.SendCallTPS = 0;
+		netServer->mMonitoringVariables.SendBytesTPS = 0;
+		netServer->mMonitoringVariables.SendCoalescedTPS = 0;
+		netServer->mMonitoringVariables.SendGatherTPS = 0;
+		netServer->mMonitoringVariables.AcceptLatencySumUs = 0;
+		netServer->mMonitoringVariables.AcceptLatencyMaxUs = 0;
 	}
 
 	LOGF(ELogLevel::System, L"Monitor Thread End (ID : %d)", ::GetCurrentThreadId());
@@ -583,6 +688,234 @@ unsigned int NetServer::monitorThread(void* netServerParam)
 	return 0;
 }
 
+void NetServer::processCompletion(Session* session, OVERLAPPED* overlapped, const DWORD transferredBytes, const DWORD errorCode, uint32_t* outRecvMessageCount, uint32_t* outSendMessageCount)
+{
+	if (errorCode != 0)
+	{
+		switch (errorCode)
+		{
+		case ERROR_SEM_TIMEOUT:
+		{
+			LOGF(ELogLevel::Debug, L"GQCS FALSE, GetLastError() = %d (SEM_TIMEOUT) -> disconnect", errorCode);
+		}
+		break;
+		case ERROR_NETNAME_DELETED:
+		case ERROR_CONNECTION_ABORTED:
+		case ERROR_OPERATION_ABORTED:
+		{
+			ASSERT_LIVE(session != nullptr, L"retGQCS FALSE, but Session is nullptr");
+		}
+		break;
+		default:
+		{
+			LOGF(ELogLevel::Error, L"GQCS FALSE, GetLastError() = %d, WSAGetLastError() = %d", errorCode, ::WSAGetLastError());
+			CrashDump::Crash();
+		}
+		break;
+		}
+
+		//   ó
+
+		goto DECREMENT_IO_COUNT;
+	}
+
+	// Process Disconnect & Send & Recv & SendRequest
+	if (overlapped == &session->SendRequestOverlapped)
+	{
+		// û ÷׸   Ŀ Enqueue Ŷ ٽ û   ִ
+		InterlockedExchange(&session->bSendRequested, 0);
+
+		session->PostSend();
+	}
+	else if (overlapped == &session->SendOverlapped)
+	{
+		*outSendMessageCount += processSendCompletion(session);
+
+		if (session->bDisconnectRegistered)
+		{
+			goto DECREMENT_IO_COUNT;
+		}
+
+		ASSERT_LIVE(InterlockedExchange(&session->bSendFlag, 0) == 1, L"more than 1 Send Error");
+
+		session->PostSend();
+	}
+	else if (overlapped == &session->RecvOverlapped)
+	{
+		if (false == processRecvCompletion(session, transferredBytes, outRecvMessageCount))
+		{
+			goto DECREMENT_IO_COUNT;
+		}
+
+		// Post Recv
+		session->PostRecv();
+	}
+	else
+	{
+		ASSERT_LIVE(false, L"Invalid OVERLAPPED");
+	}
+
+
+DECREMENT_IO_COUNT:
+
+	// ̹    IoCount 1 ν   Ϸ ó ϴ ڵ
+	session->DecrementIoCount();
+}
+
+bool NetServer::processRecvCompletion(Session* session, const DWORD transferredBytes, uint32_t* outRecvMessageCount)
+{
+	session->RecvBuffer.MoveRear(transferredBytes);
+
+	//  
+	if (transferredBytes == 0 || session->bDisconnectRegistered)
+	{
+		return false;
+	}
+
+	//  Ÿ̸Ӵ   ٽ  ʰ, Ǿ      ðŭ ٽ Ǵ
+	if (mIdleTimeout > 0)
+	{
+		session->LastRecvTick = ::timeGetTime();
+	}
+
+	NetworkHeader header{};
+
+	// packet loop
+	while (true)
+	{
+		// 1. header check
+		if (session->RecvBuffer.GetUseSize() < sizeof(NetworkHeader))
+		{
+			break;
+		}
+
+		bool retPeek = session->RecvBuffer.Peek(reinterpret_cast<char*>(&header), sizeof(header));
+		ASSERT_LIVE(retPeek == true, L"RecvBuffer Peek() Error");
+
+#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
+		// NetServer - code check
+		if (header.Code != NETWORK_HEADER_CODE)
+		{
+			return false;
+		}
+#endif
+
+		// 2. header Length check
+		if (header.Length > GetMaxPayloadLength())
+		{
+			return false;
+		}
+
+		// 3. payload check
+		if (session->RecvBuffer.GetUseSize() < sizeof(NetworkHeader) + header.Length)
+		{
+			if (session->RecvBuffer.GetFreeSize() <= 0)
+			{
+				return false;
+			}
+
+			break;
+		}
+
+		// 4. packet copy
+		Serializer* packet = Serializer::Alloc(header.Length);
+
+		bool retDequeue = session->RecvBuffer.Dequeue(packet->GetFullBufferPointer(), header.Length + sizeof(NetworkHeader));
+		ASSERT_LIVE(retDequeue == true, L"RecvBuffer Dequeue() Error");
+		packet->SetUseSize(header.Length);
+
+#if NETWORK_HEADER_USE_TYPE == NETWORK_HEADER_TYPE_NET
+		// NetServer - decode packet
+		if (false == packet->decode())
+		{
+			packet->DecrementRefCount();
+			return false;
+		}
+#endif
+
+		// 5. OnReceive()
+		OnReceive(session->ID, packet);
+
+		(*outRecvMessageCount)++;
+	}
+
+	return true;
+}
+
+uint32_t NetServer::processSendCompletion(Session* session)
+{
+	// release registered packets (  Ŷ WSASend  ̹ )
+	uint32_t registeredPacketsCount = session->RegisteredPacketCount;
+	uint32_t sendingMessageCount = session->SendingMessageCount;
+	session->RegisteredPacketCount = 0;
+	session->SendingMessageCount = 0;
+
+	for (uint32_t i = 0; i < registeredPacketsCount; ++i)
+	{
+		session->RegisteredPackets[i]->DecrementRefCount();
+	}
+
+	return sendingMessageCount;
+}
+
+void NetServer::updateAcceptLatency(const LARGE_INTEGER acceptedTick)
+{
+	LARGE_INTEGER currentTick;
+	::QueryPerformanceCounter(&currentTick);
+
+	uint32_t latencyUs = static_cast<uint32_t>((currentTick.QuadPart - acceptedTick.QuadPart) * 1'000'000 / mPerformanceFrequency.QuadPart);
+
+	InterlockedAdd64(reinterpret_cast<LONG64*>(&mMonitoringVariables.AcceptLatencySumUs), latencyUs);
+
+	// Accept 尡  ̹Ƿ ִ밪 CAS 
+	uint32_t maxUs = mMonitoringVariables.AcceptLatencyMaxUs;
+	while (latencyUs > maxUs)
+	{
+		uint32_t prevMaxUs = InterlockedCompareExchange(&mMonitoringVariables.AcceptLatencyMaxUs, latencyUs, maxUs);
+		if (prevMaxUs == maxUs)
+		{
+			break;
+		}
+
+		maxUs = prevMaxUs;
+	}
+}
+
+bool NetServer::enqueueSendPacket(Session* session, Serializer* packet)
+{
+	if (session->SendQueue.GetCount() < mSendQueueHighWater && session->SendQueue.TryEnqueue(packet))
+	{
+		return true;
+	}
+
+	// 밡 ޴ ӵ  ӵ  - Ŷ ų  ´
+	packet->DecrementRefCount();
+
+	InterlockedIncrement(&mMonitoringVariables.SendDropTPS);
+
+	if (mbIsDisconnectOnSendQueueFull && false == InterlockedExchange8(reinterpret_cast<CHAR*>(&session->bDisconnectRegistered), true))
+	{
+		LOGF(ELogLevel::System, L"SendQueue full (count = %u) -> disconnect session %llu", session->SendQueue.GetCount(), session->ID);
+
+		::CancelIoEx(reinterpret_cast<HANDLE>(session->Socket), NULL);
+	}
+
+	return false;
+}
+
+void NetServer::requestSend(Session* session)
+{
+	if (InterlockedExchange(&session->bSendRequested, 1) == 1)
+	{
+		return;
+	}
+
+	// û ó     ʵ IoCount Ƶд (Ŀ )
+	session->IncrementIoCount();
+
+	::PostQueuedCompletionStatus(mIOCP, 0, reinterpret_cast<ULONG_PTR>(session), &session->SendRequestOverlapped);
+}
+
 Session* NetServer::findSessionOrNull(const uint64_t sessionID) const
 {
 	uint32_t sessionKey = sessionID >> 32;
@@ -4,6 +4,7 @@
 
 #include "Serializer.h"
 #include "../DataStructure/LockFreeStack.h"
+#include "../DataStructure/TimerWheel.h"
 
 class Session;
 typedef void* HANDLE;
@@ -17,6 +18,17 @@ struct MonitoringVariables
     uint32_t SendMessageTPS;            // ʴ ޼ ۽ Ƚ
     uint32_t RecvPendingTPS;
     uint32_t SendPendingTPS;
+    uint32_t RecvInlineTPS;             // ʴ  ϷǾ IOCP ġ ʰ ó Recv Ƚ
+    uint32_t SendInlineTPS;             // ʴ  ϷǾ IOCP ġ ʰ ó Send Ƚ
+    uint32_t SendDropTPS;               // ʴ SendQueue    Ŷ 
+    uint32_t SendCallTPS;               // ʴ WSASend ȣ Ƚ
+    uint32_t SendBytesTPS;              // ʴ WSASend  Ʈ 
+    uint32_t SendCoalescedTPS;          // ʴ SendSlab ؼ  () Ŷ 
+    uint32_t SendGatherTPS;             // ʴ Ŷ ۸ ״ WSABUF ؼ  Ŷ 
+    uint32_t BytesPerSend;              // WSASend 1ȸ  Ʈ  (SendBytesTPS / SendCallTPS)
+    uint32_t AcceptLatencyMaxUs;        // 1  accept() Ϻ  Recv ϱ ɸ ִ ð (us)
+    uint32_t AcceptLatencyAvgUs;        // 1   Accept ó ð (us)
+    uint64_t AcceptLatencySumUs;        //   հ
     uint32_t AverageAcceptTPS;
     uint32_t AverageRecvMessageTPS;
     uint32_t AverageSendMessageTPS;
@@ -54,6 +66,40 @@ public: // 
     // ޼ ִ  (ִ ̸ Ѿ ޼    ´)
     inline void SetMaxPayloadLength(const uint16_t length) { mMaxPayloadLength = length; }
 
+    // FILE_SKIP_COMPLETION_PORT_ON_SUCCESS  
+    //  Ϸ WSARecv/WSASend GQCS ġ ʰ ȣ 忡 ٷ óѴ
+    // (TCP ڰ IFS ƴ϶ Start() ڵ )
+    inline void SetSkipCompletionPortOnSuccess(bool bToSet) { mbIsSkipCompletionPortOnSuccess = bToSet; }
+
+    // Accept   (0̸ 1) -  Accept 尡 ϳ  Ͽ accept() ȣѴ
+    inline void SetAcceptThreadCount(const uint32_t count) { mAcceptThreadCount = count; }
+
+    // Ǵ SendQueue ׾Ƶ  ִ ִ Ŷ  (0̸ DEFAULT_SEND_QUEUE_HIGH_WATER)
+    //  ̻ ̸ Ŷ , SetDisconnectOnSendQueueFull(true) ᵵ ´
+    inline void SetSendQueueHighWater(const uint32_t count) { mSendQueueHighWater = count; }
+
+    // Ǵ  Ŷ ̾ ٿ   ũ (0̸  Ŷ WSABUF ״ )
+    inline void SetSendSlabSize(const uint32_t size) { mSendSlabSize = size; }
+
+    // SendQueue  á    (false Ŷ )
+    inline void SetDisconnectOnSendQueueFull(bool bToSet) { mbIsDisconnectOnSendQueueFull = bToSet; }
+
+    //  尡 intervalSeconds Ŷ Ǯ Ѵ (0̸  )
+    //       ûũ  keepChunkCount  ִ  OS ȯ
+    inline void SetPacketPoolTrim(const uint32_t intervalSeconds, const uint32_t keepChunkCount)
+    {
+        mPacketPoolTrimSeconds = intervalSeconds;
+        mPacketPoolKeepChunkCount = keepChunkCount;
+    }
+
+    // Ŀ 尡 GetQueuedCompletionStatusEx()    ִ Ϸ   (0̸ 1)
+    inline void SetCompletionBatchCount(const uint32_t count) { mCompletionBatchCount = count; }
+
+    //  ð(ms)  ƹ͵     ´ (0̸   )
+    // Ŭ̾Ʈ ֱ ƮƮ  ̶ ƮƮ ֱ⺸ ˳ϰ ´
+    //  尡 1ʸ  Ÿ̸Ӹ ȮϹǷ ִ 1 ʰ   ִ
+    inline void SetIdleTimeout(const uint32_t timeoutMs) { mIdleTimeout = timeoutMs; }
+
     //  
     virtual void Start(
         const uint16_t port,
@@ -69,6 +115,11 @@ public: // 
     // Ŷ  û - SendQueue Enqueue
     void SendPacket(const uint64_t sessionID, Serializer* packet);
 
+    //  Ŷ  ǿ  û -  īƮ   sessionCountŭ ø
+    // SendQueue Enqueue ϰ  WSASend Ŀ 忡 Ǵ   Ƽ óϹǷ
+    //  ƽ   Ŷ ϳ WSASend  
+    void SendPacketMulti(const uint64_t* sessionIDs, const uint32_t sessionCount, Serializer* packet);
+
     //   û
     void Disconnect(const uint64_t sessionID);
 
@@ -78,6 +129,10 @@ public: // 
     //  ּҸ ´
     bool GetSessionAddress(const uint64_t sessionID, SOCKADDR_IN* outAddress) const;
 
+    //  SendQueue ׿ִ Ŷ  ´ ( ٸ false)
+    // 뷮 Ŷ  ʿ  ӵ ϱ  
+    bool GetSendQueueCount(const uint64_t sessionID, uint32_t* outCount) const;
+
 public: // Getters
 
     inline static std::wstring	GetServerVersion(void) { return L"6.7.0"; }
@@ -90,6 +145,7 @@ public: // Getters
     inline MonitoringVariables	GetMonitoringInfo(void) const { return mMonitorResult; }
     inline uint32_t				GetSessionCount(void) const { return mSessionCount; }
     inline uint32_t				GetMaxSessionCount(void) const { return mMaxSessionCount; }
+    inline uint32_t				GetSendQueueHighWater(void) const { return mSendQueueHighWater; }
 
 public: //  ڵ鷯  Լ
 
@@ -107,26 +163,62 @@ public: // 
 
 private: //  Լ
 
-    static unsigned int acceptThread(void* netServerParam);     // Accept,   
+    static unsigned int acceptThread(void* netServerParam);     // Accept,    (   )
     static unsigned int iocpWorkerThread(void* netServerParam); // IOCP ̺Ʈ ó
     static unsigned int monitorThread(void* netServerParam);    // ͸  
 
 private: //  ƿ Լ
 
+    // accept()   ݱ ð Accept ó ð ͸  ݿѴ
+    void updateAcceptLatency(const LARGE_INTEGER acceptedTick);
+
+    // SendQueue Ŷ ִ´,  áٸ Ŷ  ϰ(+ ɼǿ   ) false ȯ
+    bool enqueueSendPacket(Session* session, Serializer* packet);
+
+    // Ŀ 忡 PostSend() ûѴ (̹ û ¶ ƹ͵  )
+    void requestSend(Session* session);
+
     //  ID   ü ´
     Session* findSessionOrNull(const uint64_t sessionID) const;
 
+    // Ϸ  ϳ óϰ   ִ IoCount ҽŲ
+    // ó ޼  out ڿ ȴ (errorCode  I/O GetLastError() , ̸ 0)
+    void processCompletion(Session* session, OVERLAPPED* overlapped, const DWORD transferredBytes, const DWORD errorCode, uint32_t* outRecvMessageCount, uint32_t* outSendMessageCount);
+
+    // Recv Ϸ ó -  ͷ Ŷ  OnReceive() ȣѴ, ó ޼  out ڿ 
+    //   ϴ  false ȯ (  ٽ PostRecv() ȣ ʴ´)
+    bool processRecvCompletion(Session* session, const DWORD transferredBytes, uint32_t* outRecvMessageCount);
+
+    // Send Ϸ ó - WSASend ߴ Ŷ ϰ  Ŷ  ȯѴ
+    uint32_t processSendCompletion(Session* session);
+
 private:
 
+    enum
+    {
+        DEFAULT_SEND_QUEUE_HIGH_WATER = 1024,
+        IDLE_TIMER_TICK_MS = 1000     //  Ÿ̸   ĭ (  ֱ)
+    };
+
     bool				    mbIsRunning;				//  
     bool				    mbIsTcpNodelay;				// ɼ - TCP_NODELAY ϴ°
     bool				    mbIsSendBufferSizeZero;		// ɼ - SND_BUF  0
+    bool				    mbIsSkipCompletionPortOnSuccess; // ɼ -  Ϸ I/O IOCP ġ 
+    bool				    mbIsDisconnectOnSendQueueFull; // ɼ - SendQueue    
     HANDLE				    mIOCP;						// IOCP ڵ
     SOCKET				    mListenSocket;				//  
     uint16_t			    mPort;						// Ʈ ȣ
     uint16_t			    mMaxPayloadLength;			// ̷ε ִ  (Header.Length)
+    uint32_t			    mCompletionBatchCount;		// GQCSEx    ִ Ϸ  
+    uint32_t			    mSendQueueHighWater;		// Ǵ SendQueue ׾Ƶ  ִ ִ Ŷ 
+    uint32_t			    mSendSlabSize;				// Ǵ  Ŷ    ũ
+    uint32_t			    mPacketPoolTrimSeconds;		// Ŷ Ǯ  ֱ (0̸  X)
+    uint32_t			    mPacketPoolKeepChunkCount;	// Ŷ Ǯ   ܵ ûũ 
     uint32_t			    mMaxSessionCount;			//  ִ  
     uint32_t			    mThreadCount;				//   
+    uint32_t			    mAcceptThreadCount;			// Accept  
+    uint32_t			    mIdleTimeout;				//   ŸӾƿ (ms, 0̸  X)
+    LARGE_INTEGER		    mPerformanceFrequency;		// QueryPerformanceFrequency() 
     HANDLE* mThreads;					                //   
     MonitoringVariables     mMonitoringVariables;		// ͸  ϱ  
     MonitoringVariables     mMonitorResult;				// ͸   ( ʸ ŵ)
@@ -136,4 +228,5 @@ private:
 
     Session* mSessionList;                              //  Ʈ (Ǯ)
     LockFreeStack<uint32_t>	mUnusedSessionKeys;         //    Ű
+    TimerWheel              mIdleTimers;                // Ǻ  ŸӾƿ (mIdleTimeout > 0  )
 };
\ No newline at end of file
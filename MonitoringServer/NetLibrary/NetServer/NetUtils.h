@@ -145,6 +145,41 @@ public:
         ASSERT_LIVE(retCreateIOCP != NULL, L"RegisterIOCP() failed");
     }
 
+    // ġ TCP  ڰ  IFS ڵ ϴ Ȯ
+    // IFS ƴ (LSP)   FILE_SKIP_COMPLETION_PORT_ON_SUCCESS ϸ  ȴ
+    inline static bool      IsTcpProviderIfs(void)
+    {
+        int protocols[] = { IPPROTO_TCP, 0 };
+        DWORD bufferLength = 0;
+
+        ::WSAEnumProtocolsW(protocols, nullptr, &bufferLength);
+
+        char* buffer = new char[bufferLength];
+        WSAPROTOCOL_INFOW* protocolInfos = reinterpret_cast<WSAPROTOCOL_INFOW*>(buffer);
+
+        int protocolCount = ::WSAEnumProtocolsW(protocols, protocolInfos, &bufferLength);
+        bool ret = protocolCount != SOCKET_ERROR;
+
+        for (int i = 0; ret && i < protocolCount; ++i)
+        {
+            if ((protocolInfos[i].dwServiceFlags1 & XP1_IFS_HANDLES) == 0)
+            {
+                ret = false;
+            }
+        }
+
+        delete[] buffer;
+
+        return ret;
+    }
+
+    // SetFileCompletionNotificationModes(FILE_SKIP_COMPLETION_PORT_ON_SUCCESS)
+    //  Ϸ I/O IOCP Ϸ   Ƿ ȣ ʿ  Ϸ ó ؾ Ѵ
+    inline static bool      SetSkipCompletionPortOnSuccess(const SOCKET socket)
+    {
+        return ::SetFileCompletionNotificationModes((HANDLE)socket, FILE_SKIP_COMPLETION_PORT_ON_SUCCESS | FILE_SKIP_SET_EVENT_ON_HANDLE) != FALSE;
+    }
+
 #pragma endregion
 
 #pragma region ּ ȯ
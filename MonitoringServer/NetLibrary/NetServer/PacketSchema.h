@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "Serializer.h"
+
+////////////////////////////////////////////////
+//   ޼ Ű
+// ޼ [WORD Type][Message ü] ̷, Message ʵ   1Ʈ ķ  ü̴
+//
+//  #pragma pack(push, 1)
+//  struct SS_MONITOR_LOGIN
+//  {
+//      static constexpr uint16_t TYPE = en_PACKET_SS_MONITOR_LOGIN;
+//      int32_t ServerNo;
+//  };
+//  #pragma pack(pop)
+//
+// ʵ帶 operator>>   ˻縦 ݺ ʰ, ̸   Ȯ  memcpy   а 
+////////////////////////////////////////////////
+template <typename Message>
+class PacketSchema final
+{
+    static_assert(std::is_trivially_copyable_v<Message>, "packet message must be trivially copyable");
+    static_assert(std::is_same_v<decltype(Message::TYPE), const uint16_t>, "packet message must declare static constexpr uint16_t TYPE");
+
+#pragma pack(push, 1)
+    struct Layout
+    {
+        uint16_t Type;
+        Message Body;
+    };
+#pragma pack(pop)
+
+public:
+    static constexpr uint16_t TYPE = Message::TYPE;
+
+    // ޼ Ÿ  ̷ε  (Ʈũ  )
+    static constexpr uint32_t PACKET_SIZE = sizeof(Layout);
+
+    static_assert(PACKET_SIZE == sizeof(uint16_t) + sizeof(Message), "packet message has padding (use #pragma pack(push, 1))");
+
+    PacketSchema(void) = delete;
+
+    // ̰ Ȯ ´ ˻
+    inline static bool IsValidSize(const Serializer* packet) { return packet->GetUseSize() == PACKET_SIZE; }
+
+    // ̰ Ȯ ´´ٸ Ÿ      (  false)
+    inline static bool Decode(const Serializer* packet, Message* outMessage)
+    {
+        if (false == IsValidSize(packet))
+        {
+            return false;
+        }
+
+        memcpy(outMessage, packet->GetUserBufferPointer() + sizeof(uint16_t), sizeof(Message));
+
+        return true;
+    }
+
+    // ޼ ´ ũ Ŷ Ҵ޾ Ÿ԰     ( īƮ 1)
+    inline static Serializer* Encode(const Message& message)
+    {
+        Serializer* packet = Serializer::Alloc(PACKET_SIZE);
+
+        const Layout layout{ TYPE, message };
+        memcpy(packet->GetUserBufferPointer(), &layout, sizeof(layout));
+        packet->SetUseSize(PACKET_SIZE);
+
+        return packet;
+    }
+};
+
+////////////////////////////////////////////////
+//  (迭) ޼ Ű
+// ޼ [WORD Type][Header ü][Entry ü * Header::Count] ̷
+// Header   ʵ ȣ   Count  ϸ,   1Ʈ  ü̴
+// ̸ Count   纻   memcpy  , Ʈ 迭   Ŷ ۸ ״ Ų
+////////////////////////////////////////////////
+template <typename Header, typename Entry>
+class PacketArraySchema final
+{
+    static_assert(std::is_trivially_copyable_v<Header>, "packet header must be trivially copyable");
+    static_assert(std::is_trivially_copyable_v<Entry>, "packet entry must be trivially copyable");
+    static_assert(alignof(Entry) == 1, "packet entry has padding (use #pragma pack(push, 1))");
+    static_assert(std::is_same_v<decltype(Header::TYPE), const uint16_t>, "packet header must declare static constexpr uint16_t TYPE");
+
+    using CountType = decltype(Header::Count);
+
+    static_assert(std::is_unsigned_v<CountType>, "packet header Count must be unsigned");
+    static_assert(offsetof(Header, Count) + sizeof(CountType) == sizeof(Header), "packet header Count must be the last field");
+
+#pragma pack(push, 1)
+    struct Layout
+    {
+        uint16_t Type;
+        Header Head;
+    };
+#pragma pack(pop)
+
+public:
+    static constexpr uint16_t TYPE = Header::TYPE;
+
+    // Ʈ ϳ   ̷ε  (Ʈũ  )
+    static constexpr uint32_t FIXED_SIZE = sizeof(Layout);
+
+    static constexpr uint32_t MAX_ENTRY_COUNT = static_cast<CountType>(-1);
+
+    static constexpr uint32_t MAX_PACKET_SIZE = FIXED_SIZE + sizeof(Entry) * MAX_ENTRY_COUNT;
+
+    static_assert(FIXED_SIZE == sizeof(uint16_t) + sizeof(Header), "packet header has padding (use #pragma pack(push, 1))");
+
+    PacketArraySchema(void) = delete;
+
+    inline static constexpr uint32_t GetPacketSize(const uint32_t entryCount) { return FIXED_SIZE + sizeof(Entry) * entryCount; }
+
+    //  ϰ Ʈ 迭  ش (̰ Count   false)
+    // outEntries packet Ǳ  ȿϸ, ĵ  ּ  ִ
+    inline static bool Decode(const Serializer* packet, Header* outHeader, const Entry** outEntries)
+    {
+        if (packet->GetUseSize() < FIXED_SIZE)
+        {
+            return false;
+        }
+
+        const char* payload = packet->GetUserBufferPointer();
+
+        memcpy(outHeader, payload + sizeof(uint16_t), sizeof(Header));
+
+        if (packet->GetUseSize() != GetPacketSize(outHeader->Count))
+        {
+            return false;
+        }
+
+        *outEntries = reinterpret_cast<const Entry*>(payload + FIXED_SIZE);
+
+        return true;
+    }
+
+    // header.Count entryCount ä ( īƮ 1)
+    inline static Serializer* Encode(Header header, const Entry* entries, const uint32_t entryCount)
+    {
+        CrashDump::Assert(entryCount <= MAX_ENTRY_COUNT);
+
+        header.Count = static_cast<CountType>(entryCount);
+
+        const uint32_t packetSize = GetPacketSize(entryCount);
+        Serializer* packet = Serializer::Alloc(packetSize);
+        char* payload = packet->GetUserBufferPointer();
+
+        const Layout layout{ TYPE, header };
+        memcpy(payload, &layout, sizeof(layout));
+        memcpy(payload + FIXED_SIZE, entries, sizeof(Entry) * entryCount);
+        packet->SetUseSize(packetSize);
+
+        return packet;
+    }
+};
+
+// ̷ε   ޼ Ÿ д´ (̰ ڶ false)
+inline bool PeekPacketType(const Serializer* packet, uint16_t* outType)
+{
+    if (packet->GetUseSize() < sizeof(uint16_t))
+    {
+        return false;
+    }
+
+    memcpy(outType, packet->GetUserBufferPointer(), sizeof(uint16_t));
+
+    return true;
+}
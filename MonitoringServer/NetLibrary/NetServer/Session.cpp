@@ -19,19 +19,20 @@ void Session::Init(const SOCKET sock, const SOCKADDR_IN address, NetServer* netS
 
     ::memset(&SendOverlapped, 0, sizeof(OVERLAPPED));
     ::memset(&RecvOverlapped, 0, sizeof(OVERLAPPED));
+    ::memset(&SendRequestOverlapped, 0, sizeof(OVERLAPPED));
 
     bSendFlag = 0;
+    bSendRequested = 0;
     SessionListKey = sessionListKey;
     bDisconnected = false;
     bDisconnectRegistered = false;
 
     RecvBuffer.ClearBuffer();
 
-    while (!SendQueue.IsEmpty())
+    Serializer* remainPacket;
+    while (SendQueue.TryDequeue(remainPacket))
     {
-        Serializer* packet;
-        SendQueue.TryDequeue(packet);
-        packet->DecrementRefCount();
+        remainPacket->DecrementRefCount();
     }
 
     for (uint32_t i = 0; i < RegisteredPacketCount; ++i)
@@ -40,6 +41,7 @@ void Session::Init(const SOCKET sock, const SOCKADDR_IN address, NetServer* netS
     }
 
     RegisteredPacketCount = 0;
+    SendingMessageCount = 0;
 }
 
 bool Session::DecrementIoCount()
@@ -81,152 +83,268 @@ bool Session::DecrementIoCount()
 
 bool Session::PostRecv()
 {
-    if (bDisconnected || bDisconnectRegistered)
+    for (;;)
     {
-        return false;
-    }
+        if (bDisconnected || bDisconnectRegistered)
+        {
+            return false;
+        }
 
-    WSABUF wsabuf;
-    DWORD flags = 0;
+        WSABUF wsabuf;
+        DWORD flags = 0;
 
-    wsabuf.buf = RecvBuffer.GetRearBufferPtr();
-    wsabuf.len = RecvBuffer.GetDirectEnqueueSize();
+        wsabuf.buf = RecvBuffer.GetRearBufferPtr();
+        wsabuf.len = RecvBuffer.GetDirectEnqueueSize();
 
-    ::ZeroMemory(&RecvOverlapped, sizeof(RecvOverlapped));
+        ::ZeroMemory(&RecvOverlapped, sizeof(RecvOverlapped));
 
-    IncrementIoCount();
+        IncrementIoCount();
 
-    PROFILE_BEGIN(L"WSARecv");
-    int retWSARecv = ::WSARecv(Socket, &wsabuf, 1, NULL, &flags, &RecvOverlapped, NULL);
-    PROFILE_END(L"WSARecv");
+        int retWSARecv;
+        {
+            PROFILE_SCOPE(L"WSARecv");
+            retWSARecv = ::WSARecv(Socket, &wsabuf, 1, NULL, &flags, &RecvOverlapped, NULL);
+        }
 
-    bool ret = false;
+        bool ret = false;
 
-    if (retWSARecv == SOCKET_ERROR)
-    {
-        int errorCode = ::WSAGetLastError();
-        switch (errorCode)
-        {
-        case WSA_IO_PENDING: // IO PENDING
+        if (retWSARecv == 0 && bSkipCompletionPort)
         {
-            if (bDisconnectRegistered)
+            //  Ϸ - IOCP   Ƿ Ŀ  Recv Ϸ ó ⼭ 
+            //  Ʈ  Ϸ OVERLAPPED InternalHigh ִ
+            InterlockedIncrement(&Server->mMonitoringVariables.RecvInlineTPS);
+
+            uint32_t recvMessageCount = 0;
+            bool bContinueRecv = Server->processRecvCompletion(this, static_cast<DWORD>(RecvOverlapped.InternalHigh), &recvMessageCount);
+
+            InterlockedAdd(reinterpret_cast<LONG*>(&Server->mMonitoringVariables.RecvMessageTPS), recvMessageCount);
+
+            // ȣ  IoCount  Ƿ ⼭  
+            DecrementIoCount();
+
+            if (bContinueRecv)
             {
-                ::CancelIoEx((HANDLE)Socket, NULL);
+                continue;
             }
 
-            InterlockedIncrement(&Server->mMonitoringVariables.RecvPendingTPS);
-        }
-        break;
-        case WSAECONNRESET:
-        case WSAECONNABORTED:
-        {
-            ret = DecrementIoCount();
+            return false;
         }
-        break;
-        case WSAEINTR:
+
+        if (retWSARecv == SOCKET_ERROR)
         {
-            LOGF(ELogLevel::System, L"WSARecv WSAEINTR Error (errorCode = %d)", errorCode);
-            ret = DecrementIoCount();
-        }
-        break;
-        default:
-            LOGF(ELogLevel::Error, L"WSARecv Error (errorCode = %d)", errorCode);
-            Logger::RaiseCrash();
+            int errorCode = ::WSAGetLastError();
+            switch (errorCode)
+            {
+            case WSA_IO_PENDING: // IO PENDING
+            {
+                if (bDisconnectRegistered)
+                {
+                    ::CancelIoEx((HANDLE)Socket, NULL);
+                }
+
+                InterlockedIncrement(&Server->mMonitoringVariables.RecvPendingTPS);
+            }
+            break;
+            case WSAECONNRESET:
+            case WSAECONNABORTED:
+            {
+                ret = DecrementIoCount();
+            }
+            break;
+            case WSAEINTR:
+            {
+                LOGF(ELogLevel::System, L"WSARecv WSAEINTR Error (errorCode = %d)", errorCode);
+                ret = DecrementIoCount();
+            }
+            break;
+            default:
+                LOGF(ELogLevel::Error, L"WSARecv Error (errorCode = %d)", errorCode);
+                Logger::RaiseCrash();
+            }
         }
-    }
 
-    return ret;
+        return ret;
+    }
 }
 
 bool Session::PostSend()
 {
-    uint32_t sendCount = SendQueue.GetCount();
-
-    if (sendCount <= 0 || bDisconnected || bDisconnectRegistered)
+    for (;;)
     {
-        return false;
-    }
+        uint32_t sendCount = SendQueue.GetCount();
 
-    if (InterlockedExchange(&bSendFlag, 1))
-    {
-        return false;
-    }
+        if (sendCount <= 0 || bDisconnected || bDisconnectRegistered)
+        {
+            return false;
+        }
 
-    sendCount = SendQueue.GetCount();
+        if (InterlockedExchange(&bSendFlag, 1))
+        {
+            return false;
+        }
 
-    if (sendCount <= 0)
-    {
-        ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+        sendCount = SendQueue.GetCount();
 
-        return false;
-    }
+        if (sendCount <= 0)
+        {
+            ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
 
-    WSABUF wsabuf[MAX_WSA_BUF_COUNT];
-    int wsaBufCount;
+            // Flag    Ŷ ִٸ  ڴ PostSend() Ƿ ⼭ ٽ õ
+            if (SendQueue.GetCount() > 0)
+            {
+                continue;
+            }
 
-    for (wsaBufCount = 0; wsaBufCount < MAX_WSA_BUF_COUNT; ++wsaBufCount)
-    {
-        if (sendCount == 0)
-        {
-            break;
+            return false;
         }
 
-        Serializer* packet;
-        bool retTryDequeue = SendQueue.TryDequeue(packet);
-        ASSERT_LIVE(retTryDequeue, L"SendQueue TryDequeue Failed");
+        WSABUF wsabuf[MAX_WSA_BUF_COUNT];
+        int wsaBufCount = 0;
+        uint32_t sendSlabUseSize = 0;
+        uint32_t coalescedCount = 0;
+        uint32_t sendBytes = 0;
 
-        sendCount--;
+        while (sendCount > 0)
+        {
+            // ڸ ǰ    ĭ   
+            Serializer* packet;
+            if (false == SendQueue.TryDequeue(packet))
+            {
+                break;
+            }
 
-        wsabuf[wsaBufCount].buf = packet->GetFullBufferPointer();
-        wsabuf[wsaBufCount].len = packet->GetFullSize();
+            sendCount--;
 
-        RegisteredPackets[RegisteredPacketCount++] = packet;
-    }
+            const uint32_t packetSize = packet->GetFullSize();
+            sendBytes += packetSize;
 
-    ::ZeroMemory(&SendOverlapped, sizeof(SendOverlapped));
+            if (packetSize <= MAX_COALESCE_PACKET_SIZE && sendSlabUseSize + packetSize <= SendSlabSize)
+            {
+                //  Ŷ -  ϰ ٷ ,  WSABUF  ̶ ̾ δ
+                char* dest = SendSlab + sendSlabUseSize;
+
+                if (wsaBufCount > 0 && wsabuf[wsaBufCount - 1].buf + wsabuf[wsaBufCount - 1].len == dest)
+                {
+                    wsabuf[wsaBufCount - 1].len += packetSize;
+                }
+                else
+                {
+                    wsabuf[wsaBufCount].buf = dest;
+                    wsabuf[wsaBufCount].len = packetSize;
+                    wsaBufCount++;
+                }
+
+                ::memcpy(dest, packet->GetFullBufferPointer(), packetSize);
+                sendSlabUseSize += packetSize;
+
+                packet->DecrementRefCount();
+
+                coalescedCount++;
+            }
+            else
+            {
+                // ū Ŷ (Ǵ   ) - Ŷ ۸ ״ WSABUF  (Send Ϸ  )
+                wsabuf[wsaBufCount].buf = packet->GetFullBufferPointer();
+                wsabuf[wsaBufCount].len = packetSize;
+                wsaBufCount++;
 
-    IncrementIoCount();
+                RegisteredPackets[RegisteredPacketCount++] = packet;
+            }
 
-    PROFILE_BEGIN(L"WSASend");
-    int retWSASend = ::WSASend(Socket, wsabuf, wsaBufCount, NULL, 0, &SendOverlapped, NULL);
-    PROFILE_END(L"WSASend");
+            SendingMessageCount++;
 
-    bool ret = false;
+            if (wsaBufCount == MAX_WSA_BUF_COUNT)
+            {
+                break;
+            }
+        }
 
-    if (retWSASend == SOCKET_ERROR)
-    {
-        int errorCode = ::WSAGetLastError();
-        switch (errorCode)
+        if (wsaBufCount == 0)
+        {
+            // ุ ǰ    ĭ - ڰ ⸦ ĥ   ⼭  ʵ Flag 
+            // Ŀ 忡 PostSend() ٽ ûѴ (  ڰ PostSend() ϸ û  ť  )
+            ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+
+            Server->requestSend(this);
+
+            return false;
+        }
+
+        // monitoring
+        InterlockedIncrement(&Server->mMonitoringVariables.SendCallTPS);
+        InterlockedAdd(reinterpret_cast<LONG*>(&Server->mMonitoringVariables.SendBytesTPS), sendBytes);
+        InterlockedAdd(reinterpret_cast<LONG*>(&Server->mMonitoringVariables.SendCoalescedTPS), coalescedCount);
+        InterlockedAdd(reinterpret_cast<LONG*>(&Server->mMonitoringVariables.SendGatherTPS), SendingMessageCount - coalescedCount);
+
+        ::ZeroMemory(&SendOverlapped, sizeof(SendOverlapped));
+
+        IncrementIoCount();
+
+        int retWSASend;
         {
-        case WSA_IO_PENDING: // IO PENDING
+            PROFILE_SCOPE(L"WSASend");
+            retWSASend = ::WSASend(Socket, wsabuf, wsaBufCount, NULL, 0, &SendOverlapped, NULL);
+        }
+
+        bool ret = false;
+
+        if (retWSASend == 0 && bSkipCompletionPort)
         {
+            //  Ϸ - IOCP   Ƿ Ŀ  Send Ϸ ó ⼭ 
+            InterlockedIncrement(&Server->mMonitoringVariables.SendInlineTPS);
+
+            uint32_t sendMessageCount = Server->processSendCompletion(this);
+
+            InterlockedAdd(reinterpret_cast<LONG*>(&Server->mMonitoringVariables.SendMessageTPS), sendMessageCount);
+
+            // ȣ  IoCount  Ƿ ⼭  
+            DecrementIoCount();
+
             if (bDisconnectRegistered)
             {
-                ::CancelIoEx((HANDLE)Socket, NULL);
+                return false;
             }
 
-            InterlockedIncrement(&Server->mMonitoringVariables.SendPendingTPS);
-        }
-        break;
-        case WSAECONNRESET:
-        case WSAECONNABORTED:
-        {
-            ret = DecrementIoCount();
+            ASSERT_LIVE(InterlockedExchange(&bSendFlag, 0) == 1, L"more than 1 Send Error");
+
+            continue;
         }
-        break;
-        case WSAEINTR:
+
+        if (retWSASend == SOCKET_ERROR)
         {
-            LOGF(ELogLevel::System, L"WSASend WSAEINTR Error (errorCode = %d)", errorCode);
-            ret = DecrementIoCount();
-        }
-        break;
-        default:
-            LOGF(ELogLevel::Error, L"WSASend Error (errorCode = %d)", errorCode);
-            Logger::RaiseCrash();
+            int errorCode = ::WSAGetLastError();
+            switch (errorCode)
+            {
+            case WSA_IO_PENDING: // IO PENDING
+            {
+                if (bDisconnectRegistered)
+                {
+                    ::CancelIoEx((HANDLE)Socket, NULL);
+                }
+
+                InterlockedIncrement(&Server->mMonitoringVariables.SendPendingTPS);
+            }
+            break;
+            case WSAECONNRESET:
+            case WSAECONNABORTED:
+            {
+                ret = DecrementIoCount();
+            }
+            break;
+            case WSAEINTR:
+            {
+                LOGF(ELogLevel::System, L"WSASend WSAEINTR Error (errorCode = %d)", errorCode);
+                ret = DecrementIoCount();
+            }
+            break;
+            default:
+                LOGF(ELogLevel::Error, L"WSASend Error (errorCode = %d)", errorCode);
+                Logger::RaiseCrash();
+            }
         }
-    }
 
-    return ret;
+        return ret;
+    }
 }
 
 bool Session::TryClosesocket()
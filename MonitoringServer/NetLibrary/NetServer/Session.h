@@ -5,7 +5,7 @@
 
 #include "RingBuffer.h"
 #include "Serializer.h"
-#include "../DataStructure/LockFreeQueue.h"
+#include "../DataStructure/MpscRingQueue.h"
 
 class NetServer;
 
@@ -19,7 +19,7 @@ private:
 	Session(void) = default;
 #pragma warning(pop)
 
-	~Session() = default;
+	~Session() { delete[] SendSlab; }
 
 	//  ü ʱȭ
 	void Init(const SOCKET sock, const SOCKADDR_IN address, NetServer* netServer, const uint64_t sessionID, const uint32_t sessionListKey);
@@ -31,10 +31,13 @@ private:
 	bool DecrementIoCount(void);
 
 	// RecvBuffer  WSARecv() ȣ
+	// bSkipCompletionPort  Ϸ Recv  Լ ȿ óϰ ٽ Recv Ǵ
+	// (ȣϴ  IoCount ϳ  ־ )
 	bool PostRecv(void);
 
 	// SendBuffer  WSASend() ȣ,  bSendFlag WSASend 1ȸ 
 	// WSASend()  Ϸ    Flag 0 ְ ٽ PostSend() ȣ 
+	// bSkipCompletionPort  Ϸ Send  Լ ȿ óϰ  Ŷ ̾ 
 	bool PostSend(void);
 
 	// bDisconnected false, true ϰ  ݴ´
@@ -44,7 +47,8 @@ private:
 
 	enum
 	{
-		MAX_WSA_BUF_COUNT = 10
+		MAX_WSA_BUF_COUNT = 64,
+		MAX_COALESCE_PACKET_SIZE = 256	//  ũ  Ŷ SendSlab ؼ 
 	};
 	
 	uint64_t					ID;			// [SessionList key(index) 32bit][ID++ 32bit]	
@@ -54,15 +58,22 @@ private:
 
 	OVERLAPPED					SendOverlapped;
 	OVERLAPPED					RecvOverlapped;
+	OVERLAPPED					SendRequestOverlapped;	// Ŀ 忡 PostSend() ûϴ PQCS ( I/O  )
 	
 	uint32_t					IoCount;	// IoCount ֻ Ʈ Release Flag 
 	uint32_t					bSendFlag;
+	uint32_t					bSendRequested;	// SendRequestOverlapped PQCS ɾ 
 	uint32_t					SessionListKey;
 	bool						bDisconnected;
 	bool						bDisconnectRegistered;
+	bool						bSkipCompletionPort;	//  Ϸ I/O IOCP    Ϸ ó
+	volatile DWORD				LastRecvTick;			//  ͸  timeGetTime() ( ŸӾƿ   )
 
 	RingBuffer					RecvBuffer;
-	LockFreeQueue<Serializer*>	SendQueue;
+	MpscRingQueue<Serializer*>	SendQueue;	// ũ NetServer::Start()  (Dequeue bSendFlag  常)
 	uint32_t					RegisteredPacketCount;
 	Serializer*					RegisteredPackets[MAX_WSA_BUF_COUNT];
+	uint32_t					SendingMessageCount;	//  WSASend Ǹ ޼  (   )
+	char*						SendSlab;				//  Ŷ ̾ ٿ    (Send Ϸ   X)
+	uint32_t					SendSlabSize;
 };
\ No newline at end of file
@@ -1,153 +1,276 @@
-// version 2.0.0
-#include <cassert>
-#include <iostream>
+// version 3.0.0
+#include <cstdio>
 #include <cstring>
+#include <vector>
 #include <Windows.h>
 
-#include <unordered_map>
-
 #include "Profiler.h"
 
 #ifdef PROFILE_ON
 
-struct ProfilingData
-{
-	WCHAR Tag[MAX_TAG_LENGTH];
-	LARGE_INTEGER ElapsedTimeSum;
-	LARGE_INTEGER ElapsedTimeMin;
-	LARGE_INTEGER ElapsedTimeMax;
-	LARGE_INTEGER LastBeginTick;
-	DWORD64 CallCount;
-};
-
-ProfilingData* g_threadProfilingDatas[MAX_THREAD_COUNT];
-size_t* g_profilingDataCounts[MAX_THREAD_COUNT];
-DWORD g_threadIds[MAX_THREAD_COUNT];
-DWORD g_threadCount = 0;
-
-thread_local ProfilingData* g_profilingDatas;
-thread_local size_t* g_profilingDataCount;
-
-class ProfilerThreadInitializer
+thread_local ProfileThreadData* Profiler::tThreadData;
+
+namespace
 {
-public:
-	ProfilerThreadInitializer()
-	{
-		DWORD index = InterlockedIncrement(&g_threadCount) - 1;
-		g_profilingDatas = new ProfilingData[MAX_PROFILING_DATA_COUNT];
-		g_threadProfilingDatas[index] = g_profilingDatas;
-		g_profilingDataCount = new size_t;
-		*g_profilingDataCount = 0;
-		g_profilingDataCounts[index] = g_profilingDataCount;
-		g_threadIds[index] = GetCurrentThreadId();
+	enum : LONG
+	{
+		OVERFLOW_SLOT = MAX_PROFILING_DATA_COUNT - 1,	//  ڶ ģ ȣ ġ   
+	};
+
+	volatile LONG g_siteCount;									//    ( 0  )
+	const WCHAR* volatile g_siteTags[MAX_PROFILING_DATA_COUNT] = { nullptr };
+
+	ProfileThreadData* volatile g_threadDatas[MAX_THREAD_COUNT];
+	volatile LONG g_threadCount;
+
+	// TSC -> ð ȯ (QueryPerformanceCounter  缭 TSC ļ )
+	struct TickCalibration
+	{
+		uint64_t		BeginTick;
+		LARGE_INTEGER	BeginCounter;
+
+		TickCalibration(void)
+		{
+			::QueryPerformanceCounter(&BeginCounter);
+			BeginTick = __rdtsc();
+		}
+	};
+
+	TickCalibration g_tickCalibration;
+
+	double getTicksPerMicrosecond(void)
+	{
+		LARGE_INTEGER frequency;
+		LARGE_INTEGER counter;
+
+		::QueryPerformanceFrequency(&frequency);
+		::QueryPerformanceCounter(&counter);
+		const uint64_t tick = __rdtsc();
+
+		const double elapsedMicroseconds = static_cast<double>(counter.QuadPart - g_tickCalibration.BeginCounter.QuadPart) * 1'000'000 / frequency.QuadPart;
+
+		if (elapsedMicroseconds <= 0.0)
+		{
+			return 1.0;
+		}
+
+		return static_cast<double>(tick - g_tickCalibration.BeginTick) / elapsedMicroseconds;
 	}
-};
 
-thread_local ProfilerThreadInitializer g_profilerThreadInitializer;
+	void initSlotData(ProfileSlotData& data)
+	{
+		data.ElapsedSum = 0;
+		data.ElapsedMin = UINT64_MAX;
+		data.ElapsedMax = 0;
+		data.CallCount = 0;
+	}
 
-void ProfileBegin(const WCHAR* tag)
-{
-	for (size_t i = 0; i < *g_profilingDataCount; ++i)
+	void mergeSlotData(ProfileSlotData& dst, const ProfileSlotData& src)
 	{
-		if (wcscmp(g_profilingDatas[i].Tag, tag) == 0)
+		dst.ElapsedSum += src.ElapsedSum;
+		dst.CallCount += src.CallCount;
+
+		if (src.ElapsedMin < dst.ElapsedMin)
 		{
-			//  ִ 
-			QueryPerformanceCounter(&g_profilingDatas[i].LastBeginTick);
-			return;
+			dst.ElapsedMin = src.ElapsedMin;
+		}
+
+		if (src.ElapsedMax > dst.ElapsedMax)
+		{
+			dst.ElapsedMax = src.ElapsedMax;
 		}
 	}
 
-	//   
-	++(*g_profilingDataCount);
-	wcscpy_s(g_profilingDatas[*g_profilingDataCount - 1].Tag, tag);
-	g_profilingDatas[*g_profilingDataCount - 1].ElapsedTimeMin.QuadPart = INT64_MAX;
-	g_profilingDatas[*g_profilingDataCount - 1].ElapsedTimeMax.QuadPart = 0;
-	g_profilingDatas[*g_profilingDataCount - 1].ElapsedTimeSum.QuadPart = 0;
-	g_profilingDatas[*g_profilingDataCount - 1].CallCount = 0;
+	void writeSlotData(FILE* file, const char* threadName, const WCHAR* tag, const ProfileSlotData& data, const double ticksPerMicrosecond)
+	{
+		const double min = data.ElapsedMin / ticksPerMicrosecond;
+		const double max = data.ElapsedMax / ticksPerMicrosecond;
+		double average;
+
+		//   ̻ ҷȴٸ ּ / ִ밪   
+		if (data.CallCount > 2)
+		{
+			average = (data.ElapsedSum - data.ElapsedMin - data.ElapsedMax) / ticksPerMicrosecond / (data.CallCount - 2);
+		}
+		else
+		{
+			average = data.ElapsedSum / ticksPerMicrosecond / data.CallCount;
+		}
 
-	::QueryPerformanceCounter(&g_profilingDatas[*g_profilingDataCount - 1].LastBeginTick);
+		fprintf_s(file, "%6s | %32.32ls | %16.4fmicrosecs | %16.4fmicrosecs | %16.4fmicrosecs | %16llu |\n", threadName, tag, average, min, max, data.CallCount);
+	}
 }
 
-void ProfileEnd(const WCHAR* tag)
+LONG Profiler::registerSite(ProfileSite& site)
 {
-	for (size_t i = 0; i < *g_profilingDataCount; ++i)
+	LONG slot = InterlockedIncrement(&g_siteCount);
+
+	if (slot >= OVERFLOW_SLOT)
+	{
+		slot = OVERFLOW_SLOT;
+		g_siteTags[OVERFLOW_SLOT] = L"(too many tags)";
+	}
+	else
 	{
-		if (wcscmp(g_profilingDatas[i].Tag, tag) == 0)
+		g_siteTags[slot] = site.Tag;
+	}
+
+	//  尡 ÿ ó ߴٸ     (   )
+	const LONG prevSlot = InterlockedCompareExchange(&site.Slot, slot, 0);
+
+	if (prevSlot != 0)
+	{
+		if (slot != OVERFLOW_SLOT)
 		{
-			LARGE_INTEGER endTick;
-			LARGE_INTEGER elapsedTick;
+			g_siteTags[slot] = nullptr;
+		}
 
-			::QueryPerformanceCounter(&endTick);
+		return prevSlot;
+	}
 
-			elapsedTick.QuadPart = endTick.QuadPart - g_profilingDatas[i].LastBeginTick.QuadPart;
+	return slot;
+}
 
-			g_profilingDatas[i].ElapsedTimeSum.QuadPart += elapsedTick.QuadPart;
+ProfileThreadData* Profiler::registerThread(void)
+{
+	ProfileThreadData* threadData = new ProfileThreadData;
+	threadData->ThreadID = ::GetCurrentThreadId();
 
-			if (g_profilingDatas[i].ElapsedTimeMin.QuadPart > elapsedTick.QuadPart)
-			{
-				g_profilingDatas[i].ElapsedTimeMin.QuadPart = elapsedTick.QuadPart;
-			}
+	for (ProfileSlotData& data : threadData->Slots)
+	{
+		initSlotData(data);
+	}
 
-			if (g_profilingDatas[i].ElapsedTimeMax.QuadPart < elapsedTick.QuadPart)
-			{
-				g_profilingDatas[i].ElapsedTimeMax.QuadPart = elapsedTick.QuadPart;
-			}
+	// MAX_THREAD_COUNT      ʴ´
+	const LONG index = InterlockedIncrement(&g_threadCount) - 1;
 
-			++g_profilingDatas[i].CallCount;
-			return;
-		}
+	if (index < MAX_THREAD_COUNT)
+	{
+		InterlockedExchangePointer(reinterpret_cast<PVOID volatile*>(&g_threadDatas[index]), threadData);
 	}
 
-	assert(false);
+	tThreadData = threadData;
+
+	return threadData;
 }
 
-void ProfileDataOutText(const WCHAR* fileName)
+void Profiler::SaveText(const WCHAR* fileName)
 {
 	FILE* file;
-	LARGE_INTEGER frequency;
-
-	::QueryPerformanceFrequency(&frequency);
 
-	if (_wfopen_s(&file, fileName, L"w") == EINVAL || file == nullptr)
+	if (_wfopen_s(&file, fileName, L"w") != 0 || file == nullptr)
 	{
 		return;
 	}
 
+	const double ticksPerMicrosecond = getTicksPerMicrosecond();
+
+	//  ±׸  ȣ ġ ϳ ģ (  ±׸ )
+	std::vector<const WCHAR*> tags;
+	LONG tagIndexOfSlot[MAX_PROFILING_DATA_COUNT];
+
+	for (LONG slot = 0; slot < MAX_PROFILING_DATA_COUNT; ++slot)
+	{
+		tagIndexOfSlot[slot] = -1;
+
+		const WCHAR* tag = g_siteTags[slot];
+
+		if (tag == nullptr)
+		{
+			continue;
+		}
+
+		for (size_t i = 0; i < tags.size(); ++i)
+		{
+			if (wcscmp(tags[i], tag) == 0)
+			{
+				tagIndexOfSlot[slot] = static_cast<LONG>(i);
+				break;
+			}
+		}
+
+		if (tagIndexOfSlot[slot] == -1)
+		{
+			tagIndexOfSlot[slot] = static_cast<LONG>(tags.size());
+			tags.push_back(tag);
+		}
+	}
+
+	std::vector<ProfileSlotData> totals(tags.size());
+	std::vector<ProfileSlotData> threadTotals(tags.size());
+
+	for (ProfileSlotData& data : totals)
+	{
+		initSlotData(data);
+	}
+
 	fprintf_s(file, "--------------------------------------------------------------------------------------------------------------------------------------------------\n");
 	fprintf_s(file, "%6s | %32s | %25s | %25s | %25s | %16s |\n", "Thread", "Name", "Average", "Min", "Max", "Call");
 	fprintf_s(file, "--------------------------------------------------------------------------------------------------------------------------------------------------\n");
 
-	for (DWORD threadIndex = 0; threadIndex < g_threadCount; ++threadIndex)
+	const LONG threadCount = (g_threadCount < MAX_THREAD_COUNT) ? g_threadCount : MAX_THREAD_COUNT;
+
+	for (LONG threadIndex = 0; threadIndex < threadCount; ++threadIndex)
 	{
-		if (*g_profilingDataCounts[threadIndex] == 0)
+		const ProfileThreadData* threadData = g_threadDatas[threadIndex];
+
+		// ȣ ް   ġ  
+		if (threadData == nullptr)
 		{
 			continue;
 		}
 
-		for (size_t i = 0; i < *g_profilingDataCounts[threadIndex]; ++i)
+		for (ProfileSlotData& data : threadTotals)
 		{
-			float min = static_cast<float>(g_threadProfilingDatas[threadIndex][i].ElapsedTimeMin.QuadPart * 1'000'000) / frequency.QuadPart;
-			float max = static_cast<float>(g_threadProfilingDatas[threadIndex][i].ElapsedTimeMax.QuadPart * 1'000'000) / frequency.QuadPart;
-			LONGLONG sumExcludingOutliers = g_threadProfilingDatas[threadIndex][i].ElapsedTimeSum.QuadPart - g_threadProfilingDatas[threadIndex][i].ElapsedTimeMax.QuadPart - g_threadProfilingDatas[threadIndex][i].ElapsedTimeMin.QuadPart;
-
-			float average;
+			initSlotData(data);
+		}
 
-			if (g_threadProfilingDatas[threadIndex][i].CallCount == 2)
+		for (LONG slot = 0; slot < MAX_PROFILING_DATA_COUNT; ++slot)
+		{
+			if (tagIndexOfSlot[slot] != -1)
 			{
-				average = (min + max) / 2.0f;
+				//   尡  Ƿ ؼ д´
+				const ProfileSlotData data = threadData->Slots[slot];
+
+				mergeSlotData(threadTotals[tagIndexOfSlot[slot]], data);
 			}
-			else
+		}
+
+		char threadName[16];
+		sprintf_s(threadName, "%lu", threadData->ThreadID);
+
+		bool bWritten = false;
+
+		for (size_t i = 0; i < tags.size(); ++i)
+		{
+			if (threadTotals[i].CallCount == 0)
 			{
-				average = static_cast<float>((sumExcludingOutliers / (g_threadProfilingDatas[threadIndex][i].CallCount - 2)) * 1000000) / frequency.QuadPart;
+				continue;
 			}
 
-			fprintf_s(file, "%6d | %32ls | %16.4fmicrosecs | %16.4fmicrosecs | %16.4fmicrosecs | %16lld |\n", g_threadIds[threadIndex], g_threadProfilingDatas[threadIndex][i].Tag, average, min, max, g_threadProfilingDatas[threadIndex][i].CallCount);
+			writeSlotData(file, threadName, tags[i], threadTotals[i], ticksPerMicrosecond);
+			mergeSlotData(totals[i], threadTotals[i]);
+			bWritten = true;
+		}
+
+		if (bWritten)
+		{
+			fprintf_s(file, "--------------------------------------------------------------------------------------------------------------------------------------------------\n");
 		}
+	}
 
-		fwprintf_s(file, L"--------------------------------------------------------------------------------------------------------------------------------------------------\n");
+	//  带 ģ 
+	for (size_t i = 0; i < tags.size(); ++i)
+	{
+		if (totals[i].CallCount > 0)
+		{
+			writeSlotData(file, "All", tags[i], totals[i], ticksPerMicrosecond);
+		}
 	}
 
+	fprintf_s(file, "--------------------------------------------------------------------------------------------------------------------------------------------------\n");
+
 	fclose(file);
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -1,33 +1,131 @@
 #pragma once
 
+#include <cstdint>
+#include <intrin.h>
 #include <Windows.h>
 
 #define MAX_THREAD_COUNT 200            // ִ  
-#define MAX_PROFILING_DATA_COUNT 50     // ִ ϸ ׸ 
+#define MAX_PROFILING_DATA_COUNT 64     // ִ ϸ ȣ ġ  (  ģ ȣ ġ  )
 #define MAX_TAG_LENGTH 32               // ִ ± 
 
 /*************************** HOT TO USE ***************************/
-// ProfileBegin(L"test");
-// ...
-// ProfileEnd(L"test");
-// ProfileDataOutText(L"profile_result.txt");
+// {
+//     PROFILE_SCOPE(L"test"); //     
+//     ...
+// }
+// PROFILE_SAVE(L"profile_result.txt"); //   ʰ ݱ  
 /******************************************************************/
 
 //#define PROFILE_ON
 
 #ifdef PROFILE_ON
 
-void ProfileBegin(const WCHAR* tag); // call this function at the starting point
-void ProfileEnd(const WCHAR* tag);   // call this function at the end point
-void ProfileDataOutText(const WCHAR* fileName); // profiling data save
-#define PROFILE_BEGIN(Tag) ProfileBegin(Tag)
-#define PROFILE_END(Tag) ProfileEnd(Tag)
-#define PROFILE_SAVE(Tag) ProfileDataOutText(Tag);
+#define PROFILE_CONCAT_INNER(A, B) A##B
+#define PROFILE_CONCAT(A, B) PROFILE_CONCAT_INNER(A, B)
+
+#define PROFILE_SCOPE(Tag) \
+    static ProfileSite PROFILE_CONCAT(profileSite_, __LINE__) = { Tag, 0 }; \
+    ProfileScope PROFILE_CONCAT(profileScope_, __LINE__)(PROFILE_CONCAT(profileSite_, __LINE__))
+#define PROFILE_SAVE(FileName) Profiler::SaveText(FileName)
+
+// PROFILE_SCOPE ȣ ġ ϳ ִ  
+// ó    ȣ ޾Ƶΰ, Ŀ  ȣ 庰 迭 ٷ Ѵ (±  /  )
+struct ProfileSite
+{
+    const WCHAR*    Tag;
+    volatile LONG   Slot;   // 0̸    
+};
+
+//  ϳ  (TSC )
+struct ProfileSlotData
+{
+    uint64_t    ElapsedSum;
+    uint64_t    ElapsedMin;
+    uint64_t    ElapsedMax;
+    uint64_t    CallCount;
+};
+
+// 庰  -  常 ,   ٸ 尡 о ģ
+struct ProfileThreadData
+{
+    DWORD           ThreadID;
+    ProfileSlotData Slots[MAX_PROFILING_DATA_COUNT];
+};
+
+class Profiler final
+{
+public:
+    // ȣ ġ  ȣ (ó   ޾ƿ)
+    static inline LONG GetSlot(ProfileSite& site)
+    {
+        const LONG slot = site.Slot;
+
+        return (slot != 0) ? slot : registerSite(site);
+    }
+
+    //   slot  Ѵ
+    static inline void Add(const LONG slot, const uint64_t elapsedTick)
+    {
+        ProfileThreadData* threadData = tThreadData;
+
+        if (threadData == nullptr)
+        {
+            threadData = registerThread();
+        }
+
+        ProfileSlotData& data = threadData->Slots[slot];
+
+        data.ElapsedSum += elapsedTick;
+        data.CallCount++;
+
+        if (elapsedTick < data.ElapsedMin)
+        {
+            data.ElapsedMin = elapsedTick;
+        }
+
+        if (elapsedTick > data.ElapsedMax)
+        {
+            data.ElapsedMax = elapsedTick;
+        }
+    }
+
+    //     / ±׺ ļ Ѵ
+    //   带  ʰ Ƿ ϴ    ߳  ִ
+    static void SaveText(const WCHAR* fileName);
+
+private:
+    static LONG registerSite(ProfileSite& site);
+    static ProfileThreadData* registerThread(void);
+
+    static thread_local ProfileThreadData* tThreadData;
+};
+
+//  Ҹ ȣ ġ Կ Ѵ (TSC)
+class ProfileScope final
+{
+public:
+    explicit ProfileScope(ProfileSite& site)
+        : mSlot(Profiler::GetSlot(site))
+        , mBeginTick(__rdtsc())
+    {
+    }
+
+    ~ProfileScope(void)
+    {
+        Profiler::Add(mSlot, __rdtsc() - mBeginTick);
+    }
+
+    ProfileScope(const ProfileScope& other) = delete;
+    ProfileScope& operator=(const ProfileScope& other) = delete;
+
+private:
+    const LONG      mSlot;
+    const uint64_t  mBeginTick;
+};
 
 #else
 
-#define PROFILE_BEGIN(Tag)
-#define PROFILE_END(Tag) 
-#define PROFILE_SAVE(Tag)
+#define PROFILE_SCOPE(Tag)
+#define PROFILE_SAVE(FileName)
 
-#endif
\ No newline at end of file
+#endif
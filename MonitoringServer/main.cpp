@@ -27,7 +27,7 @@ int main(void)
 
     if (wcscmp(inputLogLevel, L"DEBUG") == 0)
     {
-        Logger::SetLogLevel(ELogLevel::System);
+        Logger::SetLogLevel(ELogLevel::Debug);
     }
     else if (wcscmp(inputLogLevel, L"ERROR") == 0)
     {
@@ -44,24 +44,109 @@ int main(void)
 
     LOGF(ELogLevel::System, L"Logger Log Level = %s", inputLogLevel);
 
+    uint32_t inputLogOverflowBlock;
+    uint32_t inputLogFlushIntervalMs;
+    uint32_t inputLogFlushBytes;
+    uint32_t inputLogBinary;
+    uint32_t inputLogRotateMB;
+    uint32_t inputLogRotateDaily;
+    uint32_t inputLogCompress;
+    uint32_t inputLogRetentionDays;
+    uint32_t inputLogRetentionMB;
+
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_OVERFLOW_BLOCK", &inputLogOverflowBlock), L"ERROR: config file read failed (LOG_OVERFLOW_BLOCK)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_FLUSH_INTERVAL_MS", &inputLogFlushIntervalMs), L"ERROR: config file read failed (LOG_FLUSH_INTERVAL_MS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_FLUSH_BYTES", &inputLogFlushBytes), L"ERROR: config file read failed (LOG_FLUSH_BYTES)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_BINARY", &inputLogBinary), L"ERROR: config file read failed (LOG_BINARY)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_ROTATE_MB", &inputLogRotateMB), L"ERROR: config file read failed (LOG_ROTATE_MB)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_ROTATE_DAILY", &inputLogRotateDaily), L"ERROR: config file read failed (LOG_ROTATE_DAILY)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_COMPRESS", &inputLogCompress), L"ERROR: config file read failed (LOG_COMPRESS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_RETENTION_DAYS", &inputLogRetentionDays), L"ERROR: config file read failed (LOG_RETENTION_DAYS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_RETENTION_MB", &inputLogRetentionMB), L"ERROR: config file read failed (LOG_RETENTION_MB)");
+
+    Logger::SetOverflowPolicy(inputLogOverflowBlock != 0 ? ELogOverflowPolicy::Block : ELogOverflowPolicy::Drop);
+    Logger::SetFlushPolicy(inputLogFlushIntervalMs, inputLogFlushBytes);
+    Logger::SetBinaryLog(inputLogBinary != 0);
+    Logger::SetRotationPolicy(inputLogRotateMB, inputLogRotateDaily != 0);
+    Logger::SetArchiveCompression(inputLogCompress != 0);
+    Logger::SetRetentionPolicy(inputLogRetentionDays, inputLogRetentionMB);
+
+    LOGF(ELogLevel::System, L"LOG_OVERFLOW_BLOCK = %u", inputLogOverflowBlock);
+    LOGF(ELogLevel::System, L"LOG_FLUSH_INTERVAL_MS = %u", inputLogFlushIntervalMs);
+    LOGF(ELogLevel::System, L"LOG_FLUSH_BYTES = %u", inputLogFlushBytes);
+    LOGF(ELogLevel::System, L"LOG_BINARY = %u", inputLogBinary);
+    LOGF(ELogLevel::System, L"LOG_ROTATE_MB = %u", inputLogRotateMB);
+    LOGF(ELogLevel::System, L"LOG_ROTATE_DAILY = %u", inputLogRotateDaily);
+    LOGF(ELogLevel::System, L"LOG_COMPRESS = %u", inputLogCompress);
+    LOGF(ELogLevel::System, L"LOG_RETENTION_DAYS = %u", inputLogRetentionDays);
+    LOGF(ELogLevel::System, L"LOG_RETENTION_MB = %u", inputLogRetentionMB);
+
     /*************************************** Config - NetServer ***************************************/
 
     uint32_t inputPortNumber;
     uint32_t inputMaxSessionCount;
     uint32_t inputConcurrentThreadCount;
     uint32_t inputWorkerThreadCount;
+    uint32_t inputAcceptThreadCount;
+    uint32_t inputCompletionBatchCount;
     uint32_t inputSetTcpNodelay;
     uint32_t inputSetSendBufZero;
+    uint32_t inputSkipIocpOnSuccess;
+    uint32_t inputSendQueueHighWater;
+    uint32_t inputSendQueueFullDisconnect;
+    uint32_t inputSendSlabSize;
+    uint32_t inputPacketPoolLargePage;
+    uint32_t inputPacketPoolTrimSeconds;
+    uint32_t inputPacketPoolKeepChunks;
+    uint32_t inputSessionIdleMs;
 
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"PORT", &inputPortNumber), L"ERROR: config file read failed (PORT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"MAX_SESSION_COUNT", &inputMaxSessionCount), L"ERROR: config file read failed (MAX_SESSION_COUNT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"CONCURRENT_THREAD_COUNT", &inputConcurrentThreadCount), L"ERROR: config file read failed (CONCURRENT_THREAD_COUNT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"WORKER_THREAD_COUNT", &inputWorkerThreadCount), L"ERROR: config file read failed (WORKER_THREAD_COUNT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"ACCEPT_THREAD_COUNT", &inputAcceptThreadCount), L"ERROR: config file read failed (ACCEPT_THREAD_COUNT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"COMPLETION_BATCH_COUNT", &inputCompletionBatchCount), L"ERROR: config file read failed (COMPLETION_BATCH_COUNT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TCP_NODELAY", &inputSetTcpNodelay), L"ERROR: config file read failed (TCP_NODELAY)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SND_BUF_ZERO", &inputSetSendBufZero), L"ERROR: config file read failed (SND_BUF_ZERO)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SKIP_IOCP_ON_SUCCESS", &inputSkipIocpOnSuccess), L"ERROR: config file read failed (SKIP_IOCP_ON_SUCCESS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SEND_QUEUE_HIGH_WATER", &inputSendQueueHighWater), L"ERROR: config file read failed (SEND_QUEUE_HIGH_WATER)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SEND_QUEUE_FULL_DISCONNECT", &inputSendQueueFullDisconnect), L"ERROR: config file read failed (SEND_QUEUE_FULL_DISCONNECT)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SEND_SLAB_SIZE", &inputSendSlabSize), L"ERROR: config file read failed (SEND_SLAB_SIZE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"PACKET_POOL_LARGE_PAGE", &inputPacketPoolLargePage), L"ERROR: config file read failed (PACKET_POOL_LARGE_PAGE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"PACKET_POOL_TRIM_SECONDS", &inputPacketPoolTrimSeconds), L"ERROR: config file read failed (PACKET_POOL_TRIM_SECONDS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"PACKET_POOL_KEEP_CHUNKS", &inputPacketPoolKeepChunks), L"ERROR: config file read failed (PACKET_POOL_KEEP_CHUNKS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"SESSION_IDLE_MS", &inputSessionIdleMs), L"ERROR: config file read failed (SESSION_IDLE_MS)");
 
     LOGF(ELogLevel::System, L"CONCURRENT_THREAD_COUNT = %u", inputConcurrentThreadCount);
     LOGF(ELogLevel::System, L"WORKER_THREAD_COUNT = %u", inputWorkerThreadCount);
+    LOGF(ELogLevel::System, L"ACCEPT_THREAD_COUNT = %u", inputAcceptThreadCount);
+    LOGF(ELogLevel::System, L"COMPLETION_BATCH_COUNT = %u", inputCompletionBatchCount);
+
+    g_monitoringServer.SetAcceptThreadCount(inputAcceptThreadCount);
+    g_monitoringServer.SetCompletionBatchCount(inputCompletionBatchCount);
+
+    LOGF(ELogLevel::System, L"SEND_QUEUE_HIGH_WATER = %u", inputSendQueueHighWater);
+
+    g_monitoringServer.SetSendQueueHighWater(inputSendQueueHighWater);
+
+    LOGF(ELogLevel::System, L"SEND_SLAB_SIZE = %u", inputSendSlabSize);
+
+    g_monitoringServer.SetSendSlabSize(inputSendSlabSize);
+
+    LOGF(ELogLevel::System, L"PACKET_POOL_TRIM_SECONDS = %u", inputPacketPoolTrimSeconds);
+    LOGF(ELogLevel::System, L"PACKET_POOL_KEEP_CHUNKS = %u", inputPacketPoolKeepChunks);
+
+    g_monitoringServer.SetPacketPoolTrim(inputPacketPoolTrimSeconds, inputPacketPoolKeepChunks);
+
+    LOGF(ELogLevel::System, L"SESSION_IDLE_MS = %u", inputSessionIdleMs);
+
+    g_monitoringServer.SetIdleTimeout(inputSessionIdleMs);
+
+    if (inputSendQueueFullDisconnect != 0)
+    {
+        g_monitoringServer.SetDisconnectOnSendQueueFull(true);
+        LOGF(ELogLevel::System, L"g_monitoringServer.SetDisconnectOnSendQueueFull(true)");
+    }
 
     if (inputSetTcpNodelay != 0)
     {
@@ -75,23 +160,59 @@ int main(void)
         LOGF(ELogLevel::System, L"myChatServer.SetSendBufferSizeToZero(true)");
     }
 
+    if (inputSkipIocpOnSuccess != 0)
+    {
+        g_monitoringServer.SetSkipCompletionPortOnSuccess(true);
+        LOGF(ELogLevel::System, L"g_monitoringServer.SetSkipCompletionPortOnSuccess(true)");
+    }
+
+    if (inputPacketPoolLargePage != 0)
+    {
+        if (Serializer::EnablePoolLargePage())
+        {
+            LOGF(ELogLevel::System, L"Serializer::EnablePoolLargePage() succeeded");
+        }
+        else
+        {
+            LOGF(ELogLevel::Error, L"Serializer::EnablePoolLargePage() failed (SeLockMemoryPrivilege required), using normal pages");
+        }
+    }
+
     /*************************************** Config - MonitoringServer ***************************************/
 
     uint32_t inputLogDBWriteIntervalMinutes;
+    uint32_t inputLogDBQueueSize;
+    uint32_t inputLogDBSpoolAfterSeconds;
+    WCHAR inputLogDBSpoolFile[MAX_PATH];
     uint32_t inputTimeout;
     uint32_t inputTimeoutCheckInterval;
+    uint32_t inputHistorySeconds;
+    uint32_t inputHistoryMemoryMB;
 
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_DB_INTERVAL_MINUTES", &inputLogDBWriteIntervalMinutes), L"ERROR: config file read failed (LOG_DB_INTERVAL_MINUTES)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_DB_QUEUE_SIZE", &inputLogDBQueueSize), L"ERROR: config file read failed (LOG_DB_QUEUE_SIZE)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"LOG_DB_SPOOL_AFTER_SECONDS", &inputLogDBSpoolAfterSeconds), L"ERROR: config file read failed (LOG_DB_SPOOL_AFTER_SECONDS)");
+    ASSERT_LIVE(ConfigReader::GetString(CONFIG_FILE_NAME, L"LOG_DB_SPOOL_FILE", inputLogDBSpoolFile, MAX_PATH), L"ERROR: config file read failed (LOG_DB_SPOOL_FILE)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TIMEOUT", &inputTimeout), L"ERROR: config file read failed (TIMEOUT)");
     ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"TIMEOUT_CHECK_INTERVAL", &inputTimeoutCheckInterval), L"ERROR: config file read failed (TIMEOUT_CHECK_INTERVAL)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"HISTORY_SECONDS", &inputHistorySeconds), L"ERROR: config file read failed (HISTORY_SECONDS)");
+    ASSERT_LIVE(ConfigReader::GetInt(CONFIG_FILE_NAME, L"HISTORY_MEMORY_MB", &inputHistoryMemoryMB), L"ERROR: config file read failed (HISTORY_MEMORY_MB)");
 
     g_monitoringServer.SetLogDBWriteIntervalMinutes(inputLogDBWriteIntervalMinutes);
+    g_monitoringServer.SetLogDBQueueCapacity(inputLogDBQueueSize);
+    g_monitoringServer.SetLogDBSpool(inputLogDBSpoolFile, inputLogDBSpoolAfterSeconds);
     g_monitoringServer.SetMaxTimeout(inputTimeout);
     g_monitoringServer.SetTimeoutCheckInterval(inputTimeoutCheckInterval);
+    g_monitoringServer.SetHistory(inputHistorySeconds, inputHistoryMemoryMB);
 
     LOGF(ELogLevel::System, L"LOG_DB_INTERVAL_MINUTES = %u", inputLogDBWriteIntervalMinutes);
+    LOGF(ELogLevel::System, L"LOG_DB_QUEUE_SIZE = %u", inputLogDBQueueSize);
+    LOGF(ELogLevel::System, L"LOG_DB_SPOOL_AFTER_SECONDS = %u", inputLogDBSpoolAfterSeconds);
+    LOGF(ELogLevel::System, L"LOG_DB_SPOOL_FILE = %s", inputLogDBSpoolFile);
     LOGF(ELogLevel::System, L"TIMEOUT = %u", inputTimeout);
     LOGF(ELogLevel::System, L"TIMEOUT_CHECK_INTERVAL = %u", inputTimeoutCheckInterval);
+    LOGF(ELogLevel::System, L"HISTORY_SECONDS = %u", inputHistorySeconds);
+    LOGF(ELogLevel::System, L"HISTORY_MEMORY_MB = %u", inputHistoryMemoryMB);
 
     // DB Connection config input
 
@@ -119,7 +240,7 @@ int main(void)
     DBConnector::InitializeLibrary();
 
     // MaxPayloadLength
-    g_monitoringServer.SetMaxPayloadLength(39);
+    g_monitoringServer.SetMaxPayloadLength(MonitorPacket::MAX_RECEIVE_PAYLOAD_LENGTH);
 
     // Server Run
     g_monitoringServer.Start(static_cast<uint16_t>(inputPortNumber), inputMaxSessionCount, inputConcurrentThreadCount, inputWorkerThreadCount);
@@ -136,27 +257,48 @@ int main(void)
                 g_monitoringServer.Shutdown();
                 break;
             }
+            else if (input == 'P' || input == 'p')
+            {
+                PROFILE_SAVE(L"profile_result.txt");
+            }
         }
 
         MonitoringVariables monitoringInfo = g_monitoringServer.GetMonitoringInfo();
 
         wprintf(L"\n\n");
         wprintf(L"[Monitoring Server Running           (Q: quit)]\n");
+#ifdef PROFILE_ON
+        wprintf(L"[                                 (P: profile)]\n");
+#endif
         wprintf(L"===============================================\n");
         wprintf(L"Session Count          : %u / %u\n", g_monitoringServer.GetSessionCount(), g_monitoringServer.GetMaxSessionCount());
-        wprintf(L"  - Monitoring Clients : %u\n", g_monitoringServer.GetConnectedClientCount());
+        wprintf(L"  - Monitoring Clients : %u (Batch : %u)\n", g_monitoringServer.GetConnectedClientCount(), g_monitoringServer.GetConnectedBatchClientCount());
         wprintf(L"  - Servers            : %u\n", g_monitoringServer.GetConnectedServerCount());
         wprintf(L"  - Unknown            : %u\n", g_monitoringServer.GetUnknownSessionCount());
         wprintf(L"===============================================\n");
         wprintf(L"Accept Total        = %llu\n", g_monitoringServer.GetTotalAcceptCount());
         wprintf(L"Disconnected Total  = %llu\n", g_monitoringServer.GetTotalDisconnectCount());
-        wprintf(L"Packet Pool Size    = %u\n", Serializer::GetTotalPacketCount());
+        wprintf(L"Packet Pool Size    = %u (%llu KB)\n", Serializer::GetTotalPacketCount(), Serializer::GetPoolSlabBytes() / 1024);
+        wprintf(L"  - Chunks in Pool  = %u\n", Serializer::GetPoolChunkInManagerCount());
+        wprintf(L"  - Thread Cached   = %u\n", Serializer::GetPoolThreadCachedCount());
+        wprintf(L"  - Remote Returned = %llu batches\n", Serializer::GetPoolRemoteFreeBatchCount());
+        wprintf(L"  - Released        = %llu KB\n", Serializer::GetPoolReleasedBytes() / 1024);
+        wprintf(L"  - Grown to Heap   = %llu\n", Serializer::GetGrownPacketCount());
+        wprintf(L"History Memory      = %llu KB (Rejected Series: %u)\n", g_monitoringServer.GetHistoryAllocatedBytes() / 1024, g_monitoringServer.GetHistoryRejectedCount());
+        wprintf(L"Log DB              = %s (Queued: %u / Spooled: %u / Dropped: %u / Spool Lost: %llu bytes)\n", g_monitoringServer.IsLogDBAvailable() ? L"Online" : L"Offline", g_monitoringServer.GetLogDBQueuedBatchCount(), g_monitoringServer.GetLogDBSpooledBatchCount(), g_monitoringServer.GetLogDBDroppedBatchCount(), g_monitoringServer.GetLogDBSpoolLostBytes());
+        wprintf(L"Logger Dropped      = %llu\n", Logger::GetDroppedLogCount());
         wprintf(L"--------------------- TPS ---------------------\n");
         wprintf(L"Accept TPS           = %7u (Avg: %7u)\n", monitoringInfo.AcceptTPS, monitoringInfo.AverageAcceptTPS);
         wprintf(L"Send Message TPS     = %7u (Avg: %7u)\n", monitoringInfo.SendMessageTPS, monitoringInfo.AverageSendMessageTPS);
         wprintf(L"Recv Message TPS     = %7u (Avg: %7u)\n", monitoringInfo.RecvMessageTPS, monitoringInfo.AverageRecvMessageTPS);
         wprintf(L"Send Pending TPS     = %7u (Avg: %7u)\n", monitoringInfo.SendPendingTPS, monitoringInfo.AverageSendPendingTPS);
         wprintf(L"Recv Pending TPS     = %7u (Avg: %7u)\n", monitoringInfo.RecvPendingTPS, monitoringInfo.AverageRecvPendingTPS);
+        wprintf(L"Send Inline TPS      = %7u\n", monitoringInfo.SendInlineTPS);
+        wprintf(L"Recv Inline TPS      = %7u\n", monitoringInfo.RecvInlineTPS);
+        wprintf(L"Send Drop TPS        = %7u\n", monitoringInfo.SendDropTPS);
+        wprintf(L"WSASend Call TPS     = %7u (Bytes/Send: %7u)\n", monitoringInfo.SendCallTPS, monitoringInfo.BytesPerSend);
+        wprintf(L"  - Coalesced / Gather = %7u / %7u\n", monitoringInfo.SendCoalescedTPS, monitoringInfo.SendGatherTPS);
+        wprintf(L"Accept Latency (us)  = %7u (Max: %7u)\n", monitoringInfo.AcceptLatencyAvgUs, monitoringInfo.AcceptLatencyMaxUs);
         wprintf(L"--------------------- CPU ---------------------\n");
         wprintf(L"Total  = Processor: %6.3f / Process: %6.3f\n", monitoringInfo.ProcessorTimeTotal, monitoringInfo.ProcessTimeTotal);
         wprintf(L"User   = Processor: %6.3f / Process: %6.3f\n", monitoringInfo.ProcessorTimeUser, monitoringInfo.ProcessTimeUser);
@@ -0,0 +1,330 @@
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../MonitoringServer/NetLibrary/NetServer/Serializer.h"
+
+////////////////////////////////////////////////
+// Serializer NET  ڵ / ڵ / üũ  ġũ
+// Serializer  PacketCodec (SSE2)  Į (reference) Ʈ  ϰ, ̷ε ũ⺰ ӵ 
+// Ŷ Serializer  Լ Ҵ / ä,  setHeaderValue()    ä
+//  : SerializerTest.exe [-nobench] (Release ؼ , ϸ  ڵ 1)
+////////////////////////////////////////////////
+
+// Serializer.h CrashDump::Assert() θ Լ ( CrashDump.cpp ΰű  Ƿ ũ ʴ´)
+void CrashDump::Crash()
+{
+	wprintf(L"CrashDump::Crash() called\n");
+	exit(1);
+}
+
+namespace
+{
+	// SSE2 ٲٱ  Į 
+	// ̸ 32Ʈ Ѵ (  65535Ʈ ̷ε忡 16Ʈ ̰ 0 )
+	namespace reference
+	{
+		uint8_t CheckSum(const unsigned char* payload, const uint32_t length)
+		{
+			uint8_t checkSum = 0;
+
+			for (uint32_t i = 0; i < length; ++i)
+			{
+				checkSum += payload[i];
+			}
+
+			return checkSum;
+		}
+
+		// packet [NetworkHeader][̷ε]
+		void Encode(unsigned char* packet)
+		{
+			const NetworkHeader* header = reinterpret_cast<const NetworkHeader*>(packet);
+			unsigned char* encodeData = packet + offsetof(NetworkHeader, CheckSum);
+
+			const uint32_t encodeLength = header->Length + 1;
+			const uint8_t randKey = header->RandKey;
+
+			uint8_t nextRandKey = 0;
+			uint8_t prevEncodedValue = 0;
+
+			for (uint32_t i = 0; i < encodeLength; ++i)
+			{
+				nextRandKey = encodeData[i] ^ (nextRandKey + randKey + i + 1);
+				encodeData[i] = nextRandKey ^ (prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+				prevEncodedValue = encodeData[i];
+			}
+		}
+
+		bool Decode(unsigned char* packet)
+		{
+			const NetworkHeader* header = reinterpret_cast<const NetworkHeader*>(packet);
+			unsigned char* decodeData = packet + offsetof(NetworkHeader, CheckSum);
+
+			const uint32_t decodeLength = header->Length + 1;
+			const uint8_t randKey = header->RandKey;
+
+			uint8_t prevEncodedValue = 0;
+			uint8_t prevRandKey = 0;
+
+			for (uint32_t i = 0; i < decodeLength; ++i)
+			{
+				uint8_t currentRandKey = decodeData[i] ^ (prevEncodedValue + NETWORK_HEADER_FIXED_KEY + i + 1);
+				prevEncodedValue = decodeData[i];
+				decodeData[i] = currentRandKey ^ (prevRandKey + randKey + i + 1);
+				prevRandKey = currentRandKey;
+			}
+
+			return decodeData[0] == CheckSum(packet + sizeof(NetworkHeader), header->Length);
+		}
+	}
+
+	double getMicroseconds(void)
+	{
+		static LARGE_INTEGER frequency = []() { LARGE_INTEGER value; ::QueryPerformanceFrequency(&value); return value; }();
+
+		LARGE_INTEGER counter;
+		::QueryPerformanceCounter(&counter);
+
+		return static_cast<double>(counter.QuadPart) * 1'000'000 / frequency.QuadPart;
+	}
+
+	// Serializer::setHeaderValue()    ä
+	void setHeader(Serializer* packet, const uint8_t randKey)
+	{
+		NetworkHeader* header = reinterpret_cast<NetworkHeader*>(packet->GetFullBufferPointer());
+
+		header->Code = NETWORK_HEADER_CODE;
+		header->Length = static_cast<uint16_t>(packet->GetUseSize());
+		header->RandKey = randKey;
+		header->CheckSum = static_cast<uint8_t>(PacketCodec::SumBytes(reinterpret_cast<const unsigned char*>(packet->GetUserBufferPointer()), packet->GetUseSize()));
+	}
+
+	//  length  ̷ε ϳ  üũ / ڵ / ڵ ( Ŷ ) reference Ѵ
+	bool checkPacket(std::mt19937& random, const uint32_t length, const bool bCorrupt)
+	{
+		const uint32_t packetSize = sizeof(NetworkHeader) + length;
+
+		Serializer* packet = Serializer::Alloc(length);
+		unsigned char* payload = reinterpret_cast<unsigned char*>(packet->GetUserBufferPointer());
+		unsigned char* fullBuffer = reinterpret_cast<unsigned char*>(packet->GetFullBufferPointer());
+
+		for (uint32_t i = 0; i < length; ++i)
+		{
+			payload[i] = static_cast<unsigned char>(random());
+		}
+
+		packet->SetUseSize(length);
+
+		bool bPassed = true;
+
+		// üũ
+		if (static_cast<uint8_t>(PacketCodec::SumBytes(payload, length)) != reference::CheckSum(payload, length))
+		{
+			wprintf(L"[FAIL] checksum (length = %u)\n", length);
+			bPassed = false;
+		}
+
+		// ڵ -  ä   reference ڵؼ 
+		setHeader(packet, static_cast<uint8_t>(random()));
+
+		std::vector<unsigned char> expected(fullBuffer, fullBuffer + packetSize);
+		reference::Encode(expected.data());
+
+		PacketCodec::Encode(fullBuffer);
+
+		if (memcmp(fullBuffer, expected.data(), packetSize) != 0)
+		{
+			wprintf(L"[FAIL] encode (length = %u)\n", length);
+			bPassed = false;
+		}
+
+		// ڵ - ڵ Ŷ  Ʈ (üũ Ǵ ̷ε) ٲ㼭   Ǵϴ Ȯ
+		if (bCorrupt)
+		{
+			const uint32_t corruptIndex = offsetof(NetworkHeader, CheckSum) + random() % (length + 1);
+			const unsigned char corruptBits = static_cast<unsigned char>(1 + random() % 255);
+
+			fullBuffer[corruptIndex] ^= corruptBits;
+			expected[corruptIndex] ^= corruptBits;
+		}
+
+		const bool bExpectedValid = reference::Decode(expected.data());
+		const bool bValid = PacketCodec::Decode(fullBuffer);
+
+		if (bValid != bExpectedValid || memcmp(fullBuffer, expected.data(), packetSize) != 0)
+		{
+			wprintf(L"[FAIL] decode (length = %u, corrupt = %d, valid = %d, expected = %d)\n", length, bCorrupt, bValid, bExpectedValid);
+			bPassed = false;
+		}
+
+		if (false == bCorrupt && false == bValid)
+		{
+			wprintf(L"[FAIL] decode rejected an intact packet (length = %u)\n", length);
+			bPassed = false;
+		}
+
+		Serializer::Free(packet);
+
+		return bPassed;
+	}
+
+	//  1..1000 ,  ̻  ̿ ִ  ó ˻
+	bool runPropertyTest(void)
+	{
+		std::mt19937 random(20240101);
+
+		uint32_t checkedCount = 0;
+		uint32_t failedCount = 0;
+
+		auto check = [&](const uint32_t length)
+			{
+				for (int corrupt = 0; corrupt < 2; ++corrupt)
+				{
+					checkedCount++;
+
+					if (false == checkPacket(random, length, corrupt != 0))
+					{
+						failedCount++;
+					}
+				}
+			};
+
+		for (uint32_t length = 1; length <= 1'000; ++length)
+		{
+			for (int repeat = 0; repeat < 16; ++repeat)
+			{
+				check(length);
+			}
+		}
+
+		for (int repeat = 0; repeat < 2'000; ++repeat)
+		{
+			check(1'001 + random() % (Serializer::MAX_PAYLOAD_SIZE - 1'000));
+		}
+
+		for (uint32_t length = Serializer::MAX_PAYLOAD_SIZE - 16; length <= Serializer::MAX_PAYLOAD_SIZE; ++length)
+		{
+			check(length);
+		}
+
+		wprintf(L"property test : %u packets, %u failed\n", checkedCount, failedCount);
+
+		return failedCount == 0;
+	}
+
+	// ̷ε ũ⺰ reference SSE2  Ŷ ϳ ð (ns)
+	void runBenchmark(void)
+	{
+		static const uint32_t LENGTHS[] = { 1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1'000 };
+		static constexpr uint32_t TARGET_BYTES = 64 * 1024 * 1024;
+
+		std::mt19937 random(1);
+
+		wprintf(L"\n%6s | %28s | %28s | %28s\n", L"length", L"checksum ref / sse2 (ns)", L"encode ref / new (ns)", L"decode ref / sse2 (ns)");
+
+		for (const uint32_t length : LENGTHS)
+		{
+			const uint32_t iterationCount = TARGET_BYTES / (length + sizeof(NetworkHeader));
+
+			Serializer* packet = Serializer::Alloc(length);
+			unsigned char* payload = reinterpret_cast<unsigned char*>(packet->GetUserBufferPointer());
+			unsigned char* fullBuffer = reinterpret_cast<unsigned char*>(packet->GetFullBufferPointer());
+
+			for (uint32_t i = 0; i < length; ++i)
+			{
+				payload[i] = static_cast<unsigned char>(random());
+			}
+
+			packet->SetUseSize(length);
+			setHeader(packet, static_cast<uint8_t>(random()));
+
+			//  Ƽ ؾ ȭ  ʴ´
+			uint32_t sink = 0;
+			double elapsed[6];
+			double beginTime;
+
+			beginTime = getMicroseconds();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				payload[0] = static_cast<unsigned char>(i);
+				sink += reference::CheckSum(payload, length);
+			}
+			elapsed[0] = getMicroseconds() - beginTime;
+
+			beginTime = getMicroseconds();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				payload[0] = static_cast<unsigned char>(i);
+				sink += PacketCodec::SumBytes(payload, length);
+			}
+			elapsed[1] = getMicroseconds() - beginTime;
+
+			// ڵ / ڵ ڸ ٲǷ  ۸ ݺؼ ȯѴ ( ޶ ɸ ð )
+			beginTime = getMicroseconds();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				reference::Encode(fullBuffer);
+			}
+			elapsed[2] = getMicroseconds() - beginTime;
+
+			beginTime = getMicroseconds();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				PacketCodec::Encode(fullBuffer);
+			}
+			elapsed[3] = getMicroseconds() - beginTime;
+
+			beginTime = getMicroseconds();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				sink += reference::Decode(fullBuffer);
+			}
+			elapsed[4] = getMicroseconds() - beginTime;
+
+			beginTime = getMicroseconds();
+			for (uint32_t i = 0; i < iterationCount; ++i)
+			{
+				sink += PacketCodec::Decode(fullBuffer);
+			}
+			elapsed[5] = getMicroseconds() - beginTime;
+
+			sink += fullBuffer[sizeof(NetworkHeader) + length - 1];
+
+			for (double& value : elapsed)
+			{
+				value = value * 1'000 / iterationCount;
+			}
+
+			wprintf(L"%6u | %11.2f / %8.2f (%4.1fx) | %11.2f / %8.2f (%4.1fx) | %11.2f / %8.2f (%4.1fx)  [%u]\n", length,
+				elapsed[0], elapsed[1], elapsed[0] / elapsed[1],
+				elapsed[2], elapsed[3], elapsed[2] / elapsed[3],
+				elapsed[4], elapsed[5], elapsed[4] / elapsed[5], sink & 0xF);
+
+			Serializer::Free(packet);
+		}
+	}
+}
+
+int wmain(int argc, WCHAR* argv[])
+{
+	const bool bBenchmark = (argc < 2 || wcscmp(argv[1], L"-nobench") != 0);
+
+	if (false == runPropertyTest())
+	{
+		wprintf(L"FAILED\n");
+		return 1;
+	}
+
+	if (bBenchmark)
+	{
+		runBenchmark();
+	}
+
+	wprintf(L"PASSED\n");
+
+	return 0;
+}